@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 //Dear emacs, this is -*-c++-*-
@@ -44,6 +44,12 @@ class CaloClusterLocalCalib : public CaloClusterProcessor {
   virtual StatusCode execute(const EventContext& ctx,
                              xAOD::CaloCluster* theCluster) const override;
 
+  /// Apply corrections to all clusters of a container: clusters are
+  /// classified first, then each calibration tool weights the selected
+  /// clusters in one call
+  virtual StatusCode execute(const EventContext& ctx,
+                             xAOD::CaloClusterContainer* clusColl) const override;
+
 
   /// Standard AlgTool constructor
   CaloClusterLocalCalib(const std::string& type,
@@ -52,6 +58,9 @@ class CaloClusterLocalCalib : public CaloClusterProcessor {
   
  private:
 
+  /// Classify the cluster and check it against the selected reco statuses
+  bool classifyAndSelect(xAOD::CaloCluster* theCluster) const;
+
   /// property:  Classification tools
   ToolHandleArray<IClusterClassificationTool>  m_classificationTool;
   //Remark: This handle should be 0 or 1 entries. Our configurable framework can't handle 
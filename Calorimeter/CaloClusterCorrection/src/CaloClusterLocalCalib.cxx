@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "CaloClusterCorrection/CaloClusterLocalCalib.h"
@@ -56,8 +56,7 @@ StatusCode  CaloClusterLocalCalib::initialize() {
   return StatusCode::SUCCESS;
 }
 
-StatusCode  CaloClusterLocalCalib::execute(const EventContext& ctx,
-                                           CaloCluster* theCluster) const
+bool CaloClusterLocalCalib::classifyAndSelect(CaloCluster* theCluster) const
 {
   CaloRecoStatus& recoStatus=theCluster->recoStatus();
   // call classification tool
@@ -68,7 +67,45 @@ StatusCode  CaloClusterLocalCalib::execute(const EventContext& ctx,
   bool isSelected (false);
   for (unsigned int i=0;!isSelected && i<m_recoStatus.size();i++ )
     isSelected = recoStatus.checkStatus(CaloRecoStatus::StatusIndicator(m_recoStatus[i]));
-  if ( isSelected ) {    
+  return isSelected;
+}
+
+StatusCode  CaloClusterLocalCalib::execute(const EventContext& ctx,
+                                           xAOD::CaloClusterContainer* clusColl) const
+{
+  // the replica clusters of the negative cluster option are weighted one by one
+  if ( m_absOpt ) {
+    return CaloClusterProcessor::execute(ctx, clusColl);
+  }
+
+  std::vector<CaloCluster*> selected;
+  selected.reserve(clusColl->size());
+  for (CaloCluster* theCluster : *clusColl) {
+    if ( classifyAndSelect(theCluster) ) {
+      selected.push_back(theCluster);
+    }
+  }
+
+  if ( !selected.empty() ) {
+    for (const ToolHandle<IClusterCellWeightTool>& tool : m_calibTools) {
+      if (tool->weightClusters(selected,ctx).isFailure())
+        msg(MSG::ERROR) << " failed to weight clusters " << endmsg;
+    }
+  }
+
+  // PL add calibration method bits to reco status
+  for (CaloCluster* theCluster : *clusColl) {
+    theCluster->recoStatus().setStatus(CaloRecoStatus::CALIBRATEDLHC);
+  }
+
+  return StatusCode::SUCCESS;
+}
+
+StatusCode  CaloClusterLocalCalib::execute(const EventContext& ctx,
+                                           CaloCluster* theCluster) const
+{
+  CaloRecoStatus& recoStatus=theCluster->recoStatus();
+  if ( classifyAndSelect(theCluster) ) {    
     if( m_absOpt ){  
         
 
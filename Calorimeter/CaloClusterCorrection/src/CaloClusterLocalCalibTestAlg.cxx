@@ -0,0 +1,183 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file  CaloClusterLocalCalibTestAlg.cxx
+ * @date Oct, 2022
+ * @brief Regression test for CaloClusterLocalCalib: calibrating a whole
+ *        cluster container must give the same cell weights as calibrating
+ *        the clusters one by one.
+ */
+
+#undef NDEBUG
+
+
+#include "CaloClusterLocalCalibTestAlg.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloClusterCellLink.h"
+#include "CaloEvent/CaloRecoStatus.h"
+#include "xAODCaloEvent/CaloClusterKineHelper.h"
+#include "AthenaKernel/errorcheck.h"
+#include "TestTools/random.h"
+#include "CLHEP/Units/SystemOfUnits.h"
+#include <iostream>
+#include <cassert>
+
+
+using CLHEP::GeV;
+
+
+/** 
+ * @brief Standard Gaudi initialize method.
+ */
+StatusCode CaloClusterLocalCalibTestAlg::initialize()
+{
+  CHECK( m_tool.retrieve() );
+  ATH_CHECK( m_caloMgrKey.initialize() );
+  return StatusCode::SUCCESS;
+}
+
+
+CaloCellContainer*
+CaloClusterLocalCalibTestAlg::make_cells (const CaloDetDescrManager& ddman)
+{
+  CaloCellContainer* cells = new CaloCellContainer;
+  for (CaloCell_ID::SUBCALO subcalo : { CaloCell_ID::LAREM,
+                                        CaloCell_ID::LARHEC,
+                                        CaloCell_ID::LARFCAL })
+  {
+    for (const CaloDetDescrElement* dde : ddman.element_range (subcalo)) {
+      float energy = Athena_test::randf_seed (m_seed, 10*GeV);
+      cells->push_back (new CaloCell (dde, energy, 0, 0, 0,
+                                      CaloGain::LARMEDIUMGAIN) );
+    }
+  }
+  cells->order();
+  cells->updateCaloIterators();
+  return cells;
+}
+
+
+std::vector<CaloClusterLocalCalibTestAlg::ClusterSpec>
+CaloClusterLocalCalibTestAlg::make_specs (const CaloDetDescrManager& ddman,
+                                          const CaloCellContainer& cells)
+{
+  std::vector<ClusterSpec> specs (50);
+  std::vector<IdentifierHash> hashes;
+  for (ClusterSpec& spec : specs) {
+    const double eta = Athena_test::randf_seed (m_seed, 9.) - 4.5;
+    const double phi = Athena_test::randf_seed (m_seed, 6.) - 3.;
+    hashes.clear();
+    ddman.cellsInZone (eta - 0.1, eta + 0.1, phi - 0.1, phi + 0.1, hashes);
+    for (IdentifierHash hash : hashes) {
+      int idx = cells.findIndex (hash);
+      if (idx < 0) continue;
+      // cells shared between clusters carry a weight < 1
+      const float weight = 0.5 + Athena_test::randf_seed (m_seed, 0.5);
+      spec.cells.emplace_back (idx, weight);
+    }
+    spec.emProbability = Athena_test::randf_seed (m_seed, 1.);
+    // only the clusters tagged as hadronic are selected by the tool
+    spec.hadronic = Athena_test::randf_seed (m_seed, 1.) < 0.7;
+  }
+  return specs;
+}
+
+
+std::unique_ptr<xAOD::CaloClusterContainer>
+CaloClusterLocalCalibTestAlg::make_clusters (const std::vector<ClusterSpec>& specs,
+                                             const CaloCellContainer* cells,
+                                             xAOD::CaloClusterAuxContainer& aux) const
+{
+  auto clusters = std::make_unique<xAOD::CaloClusterContainer>();
+  clusters->setStore (&aux);
+  for (const ClusterSpec& spec : specs) {
+    xAOD::CaloCluster* cl = new xAOD::CaloCluster;
+    clusters->push_back (cl);
+    cl->addCellLink (new CaloClusterCellLink (cells));
+    for (const std::pair<int, float>& c : spec.cells) {
+      cl->addCell (c.first, c.second);
+    }
+    CaloClusterKineHelper::calculateKine (cl, true, true);
+    cl->insertMoment (xAOD::CaloCluster::EM_PROBABILITY, spec.emProbability);
+    cl->recoStatus().setStatus (spec.hadronic ? CaloRecoStatus::TAGGEDHAD
+                                              : CaloRecoStatus::TAGGEDEM);
+  }
+  return clusters;
+}
+
+
+StatusCode CaloClusterLocalCalibTestAlg::test1()
+{
+  std::cout << "test1\n";
+
+  const EventContext& ctx = Gaudi::Hive::currentContext();
+
+  SG::ReadCondHandle<CaloDetDescrManager> caloMgrHandle{m_caloMgrKey, ctx};
+  assert (caloMgrHandle.isValid());
+  const CaloDetDescrManager* ddman = *caloMgrHandle;
+
+  const CaloCellContainer* cells = make_cells (*ddman);
+  CHECK( evtStore()->record (cells, "AllCalo") );
+  const std::vector<ClusterSpec> specs = make_specs (*ddman, *cells);
+
+  // One copy of the clusters is calibrated cluster by cluster,
+  // the other one with a single call for the container.
+  xAOD::CaloClusterAuxContainer aux1;
+  xAOD::CaloClusterAuxContainer aux2;
+  std::unique_ptr<xAOD::CaloClusterContainer> clusters1 =
+    make_clusters (specs, cells, aux1);
+  std::unique_ptr<xAOD::CaloClusterContainer> clusters2 =
+    make_clusters (specs, cells, aux2);
+
+  for (xAOD::CaloCluster* cl : *clusters1) {
+    CHECK( m_tool->execute (ctx, cl) );
+  }
+  CHECK( m_tool->execute (ctx, clusters2.get()) );
+
+  size_t nchanged = 0;
+  for (size_t i = 0; i < specs.size(); i++) {
+    const xAOD::CaloCluster* cl1 = (*clusters1)[i];
+    const xAOD::CaloCluster* cl2 = (*clusters2)[i];
+    assert (cl1->size() == cl2->size());
+    if (cl1->e() != cl2->e()) {
+      std::cout << "Energy mismatch " << i << " "
+                << cl1->e() << " " << cl2->e() << "\n";
+    }
+    if (cl1->recoStatus().getStatusWord() != cl2->recoStatus().getStatusWord()) {
+      std::cout << "Status mismatch " << i << " "
+                << cl1->recoStatus().getStatusWord() << " "
+                << cl2->recoStatus().getStatusWord() << "\n";
+    }
+    xAOD::CaloCluster::const_cell_iterator it1 = cl1->cell_begin();
+    xAOD::CaloCluster::const_cell_iterator it2 = cl2->cell_begin();
+    size_t icell = 0;
+    for (; it1 != cl1->cell_end(); ++it1, ++it2, ++icell) {
+      assert (it1.index() == it2.index());
+      if (it1.weight() != it2.weight()) {
+        std::cout << "Weight mismatch " << i << " " << it1.index() << " "
+                  << it1.weight() << " " << it2.weight() << "\n";
+      }
+      if (it1.weight() != specs[i].cells[icell].second) {
+        // clusters which are not selected must not be weighted
+        assert (specs[i].hadronic);
+        ++nchanged;
+      }
+    }
+  }
+
+  // Make sure the comparison is not trivial.
+  assert (nchanged > 0);
+
+  return StatusCode::SUCCESS;
+}
+
+
+/** 
+ * @brief Standard Gaudi execute method.
+ */
+StatusCode CaloClusterLocalCalibTestAlg::execute()
+{
+  CHECK( test1() );
+  return StatusCode::SUCCESS;
+}
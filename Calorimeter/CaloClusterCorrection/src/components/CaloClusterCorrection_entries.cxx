@@ -49,6 +49,7 @@
 #include "../CaloClusterRemoveBad.h"
 
 #include "../CaloDummyCorrection.h"
+#include "../CaloClusterLocalCalibTestAlg.h"
 
 
 DECLARE_COMPONENT( CaloClusterLocalCalib )
@@ -102,4 +103,5 @@ DECLARE_COMPONENT( CaloClusterRemoveDuplicates )
 DECLARE_COMPONENT( CaloClusterRemoveBad )
 
 DECLARE_COMPONENT( CaloDummyCorrection )
+DECLARE_COMPONENT( CaloClusterLocalCalibTestAlg )
 
@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+#
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration.
+#
+# File: CaloClusterCorrection/test/CaloClusterLocalCalib_test.py
+# Date: Oct, 2022
+# Brief: Test that CaloClusterLocalCalib gives the same cell weights when
+#        calibrating a cluster container at once as when calibrating
+#        the clusters one by one.
+#
+
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.ComponentFactory import CompFactory
+
+
+def testCfg (configFlags):
+    result = ComponentAccumulator()
+
+    from LArGeoAlgsNV.LArGMConfig import LArGMCfg
+    result.merge (LArGMCfg (configFlags))
+
+    from CaloTools.CaloNoiseCondAlgConfig import CaloNoiseCondAlgCfg
+    result.merge (CaloNoiseCondAlgCfg (configFlags, 'electronicNoise'))
+
+    from CaloRec.CaloTopoClusterConfig import caloTopoCoolFolderCfg
+    result.merge (caloTopoCoolFolderCfg (configFlags))
+
+    weightTool = CompFactory.CaloLCWeightTool ('LCWeight',
+                                               CorrectionKey = 'H1ClusterCellWeights',
+                                               SignalOverNoiseCut = 2.0,
+                                               UseHadProbability = True)
+    tool = CompFactory.CaloClusterLocalCalib ('LocalCalib',
+                                              LocalCalibTools = [weightTool],
+                                              ClusterRecoStatus = [2]) # TAGGEDHAD
+    result.addEventAlgo (CompFactory.CaloClusterLocalCalibTestAlg ('CaloClusterLocalCalibTestAlg',
+                                                                   CalibTool = tool))
+    return result
+
+
+from AthenaConfiguration.AllConfigFlags import ConfigFlags
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+
+ConfigFlags.Input.Files = defaultTestFiles.RDO_RUN2
+ConfigFlags.Input.TimeStamp = 1000
+ConfigFlags.Detector.GeometryLAr = True
+ConfigFlags.needFlagsCategory('LAr')
+
+ConfigFlags.lock()
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg 
+acc=MainServicesCfg (ConfigFlags)
+
+from McEventSelector.McEventSelectorConfig import McEventSelectorCfg
+acc.merge (McEventSelectorCfg (ConfigFlags))
+
+acc.merge (testCfg (ConfigFlags))
+acc.run(1)
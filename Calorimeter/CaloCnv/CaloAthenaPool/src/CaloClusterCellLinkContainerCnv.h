@@ -1,7 +1,7 @@
 // Dear emacs, this is -*- c++ -*-
 
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 // $Id: CaloClusterCellLinkContainerCnv.h 781569 2016-11-01 12:16:14Z wlampl $
@@ -9,11 +9,13 @@
 #define CALOCLUSTERCELLLINKCONTAINERCNV_H
 
 #include "CaloTPCnv/CaloClusterCellLinkContainerCnv_p1.h"
+#include "CaloTPCnv/CaloClusterCellLinkContainerCnv_p2.h"
 #include "CaloEvent/CaloClusterCellLinkContainer.h"
 #include "AthenaPoolCnvSvc/T_AthenaPoolTPCnvCnv.h"
 
 
 typedef T_AthenaPoolTPCnvCnv<CaloClusterCellLinkContainer,
+                             CaloClusterCellLinkContainerCnv_p2,
                              CaloClusterCellLinkContainerCnv_p1,
                              T_TPCnvNull<CaloClusterCellLinkContainer> >
   CaloClusterCellLinkContainerCnv;
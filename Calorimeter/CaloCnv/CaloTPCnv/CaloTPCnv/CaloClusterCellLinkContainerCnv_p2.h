@@ -0,0 +1,68 @@
+//Dear emacs, this is -*- C++ -*-.
+
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+
+#ifndef CALOTPCNV_CALOCLUSTERCELLLINKCNTCNV_P2
+#define CALOTPCNV_CALOCLUSTERCELLLINKCNTCNV_P2
+
+#include "CaloEvent/CaloClusterCellLinkContainer.h"
+#include "CaloTPCnv/CaloClusterCellLinkContainer_p2.h"
+#include "AthenaPoolCnvSvc/T_AthenaPoolTPConverter.h"
+#include "DataModelAthenaPool/DataLinkCnv_p2.h"
+#include "CxxUtils/FloatCompressor.h"
+
+/**
+ * @brief T/P conversions for CaloClusterCellLinkContainerCnv_p2
+ *
+ * Cells are written sorted by index, so clusters read back
+ * iterate over the cell container in increasing order.
+ */
+class CaloClusterCellLinkContainerCnv_p2
+  : public T_AthenaPoolTPCnvWithKeyBase<CaloClusterCellLinkContainer, CaloClusterCellLinkContainer_p2>
+{
+public:
+  using base_class::transToPersWithKey;
+  using base_class::persToTransWithKey;
+
+
+  /**
+   * @brief Convert from persistent to transient object.
+   * @param pers The persistent object to convert.
+   * @param trans The transient object to which to convert.
+   * @param key SG key of the object being read.
+   * @param log Error logging stream.
+   */
+  virtual
+  void persToTransWithKey (const CaloClusterCellLinkContainer_p2* pers,
+                           CaloClusterCellLinkContainer* trans,
+                           const std::string& key,
+                           MsgStream& log) const override;
+
+
+  /**
+   * @brief Convert from transient to persistent object.
+   * @param trans The transient object to convert.
+   * @param pers The persistent object to which to convert.
+   * @param key SG key of the object being written.
+   * @param log Error logging stream.
+   */
+  virtual
+  void transToPersWithKey (const CaloClusterCellLinkContainer* trans,
+                           CaloClusterCellLinkContainer_p2* pers,
+                           const std::string& key,
+                           MsgStream& log) const override;
+
+
+private:
+  DataLinkCnv_p2<DataLink<CaloCellContainer> > m_linkCnv;
+
+  /// Reduces the weights to the precision stored in the persistent object
+  CxxUtils::FloatCompressor m_compressor{7};
+
+};
+
+
+#endif
@@ -0,0 +1,30 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+//Dear emacs, this is -*-c++-*-
+#ifndef CALOATHENAPOOL_CALOCLUSTERCELLLINKCONTAINER_P2_H
+#define CALOATHENAPOOL_CALOCLUSTERCELLLINKCONTAINER_P2_H
+
+#include <vector>
+#include <cstdint>
+#include "DataModelAthenaPool/DataLink_p2.h"
+
+/**
+ * @brief Compact persistent form of CaloClusterCellLinkContainer.
+ *
+ * The cells of each cluster are sorted by index. For each cell the
+ * difference to the previous index (shifted left by one, lowest bit set
+ * if the weight is not 1) is stored as a variable-length integer with
+ * 7 bits per byte. Weights different from 1 are stored as the upper
+ * 16 bits of the float (7 mantissa bits, rounded).
+ */
+class CaloClusterCellLinkContainer_p2 {
+ public:
+  std::vector<uint8_t> m_indexDeltas;
+  std::vector<uint16_t> m_weights;
+  std::vector<unsigned> m_nCellsPerCluster; //Number of cells in each cluster
+  DataLink_p2 m_cellCont;
+};
+
+#endif
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOATHENAPOOL_CALOATHENAPOOLCNVDICT_H
@@ -23,6 +23,7 @@
 #include "CaloTPCnv/CaloClusterMomentContainer_p1.h"
 #include "CaloTPCnv/CaloSamplingDataContainer_p1.h"
 #include "CaloTPCnv/CaloCellLinkContainer_p2.h"
+#include "CaloTPCnv/CaloClusterCellLinkContainer_p2.h"
 
 //Version 3
 #include "CaloTPCnv/CaloClusterContainer_p3.h"
@@ -0,0 +1,163 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "CaloTPCnv/CaloClusterCellLinkContainerCnv_p2.h"
+#include "AthenaKernel/getThinningCache.h"
+#include "AthenaKernel/ThinningCache.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+  const unsigned HAS_WEIGHT_BIT=0x1;
+  const unsigned WEIGHT_SHIFT=16;
+
+  /// Append @c value as variable-length integer, 7 bits per byte.
+  inline void putVarint (uint32_t value, std::vector<uint8_t>& out)
+  {
+    while (value >= 0x80) {
+      out.push_back (static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back (static_cast<uint8_t>(value));
+  }
+
+  /// Decode a variable-length integer starting at @c pos.
+  /// Returns false if the input ends before the integer does.
+  inline bool getVarint (const std::vector<uint8_t>& in, size_t& pos, uint32_t& value)
+  {
+    value=0;
+    for (unsigned shift=0; pos<in.size() && shift<32; shift+=7) {
+      const uint8_t byte=in[pos++];
+      value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+    return false;
+  }
+
+  inline uint16_t packWeight (float fweight)
+  {
+    CxxUtils::FloatCompressor::floatint_t fi;
+    fi.fvalue=fweight;
+    return static_cast<uint16_t>(fi.ivalue >> WEIGHT_SHIFT);
+  }
+
+  inline float unpackWeight (uint16_t pweight)
+  {
+    CxxUtils::FloatCompressor::floatint_t fi;
+    fi.ivalue=static_cast<uint32_t>(pweight) << WEIGHT_SHIFT;
+    return fi.fvalue;
+  }
+
+} //anonymous namespace
+
+
+void
+CaloClusterCellLinkContainerCnv_p2::persToTransWithKey (const CaloClusterCellLinkContainer_p2* pers,
+                                                        CaloClusterCellLinkContainer* trans,
+                                                        const std::string& /*key*/,
+                                                        MsgStream& msg) const
+{
+  const size_t nClusters=pers->m_nCellsPerCluster.size();
+  const size_t maxWeightIdx=pers->m_weights.size();
+
+  trans->reserve(nClusters);
+  size_t persIdx=0;
+  size_t weightIdx=0;
+  bool consistent=true;
+  for (size_t iCluster=0;iCluster<nClusters;++iCluster) {
+    DataLink<CaloCellContainer> link;
+    m_linkCnv.persToTrans(pers->m_cellCont,link,msg);
+    CaloClusterCellLink* cccl=new CaloClusterCellLink(link);
+    trans->push_back(cccl);
+    const unsigned nCells=pers->m_nCellsPerCluster[iCluster];
+    cccl->reserve(nCells);
+    uint32_t index=0;
+    for (unsigned iCell=0;consistent && iCell<nCells;++iCell) {
+      uint32_t value=0;
+      if (!getVarint(pers->m_indexDeltas,persIdx,value)) {
+        msg << MSG::ERROR << "Inconsistent persistent object: index stream ended in cluster " << iCluster << endmsg;
+        consistent=false;
+        break;
+      }
+      index+=(value >> 1);
+      if (value & HAS_WEIGHT_BIT) {
+        if (weightIdx >= maxWeightIdx) {
+          msg << MSG::ERROR << "Inconsistent persistent object: To few persistent weights, got only "
+              << maxWeightIdx << endmsg;
+          consistent=false;
+          break;
+        }
+        cccl->addCell(index, unpackWeight(pers->m_weights[weightIdx++]));
+      }
+      else {
+        cccl->addCell(index,1.0);
+      }
+    }//end loop over cells in cluster
+  }//end loop over clusters
+}
+
+
+void
+CaloClusterCellLinkContainerCnv_p2::transToPersWithKey (const CaloClusterCellLinkContainer* trans,
+                                                        CaloClusterCellLinkContainer_p2* pers,
+                                                        const std::string& key,
+                                                        MsgStream &msg) const
+{
+  const SG::ThinningCache* tcache = SG::getThinningCache();
+
+  const SG::ThinningDecisionBase* dec_cells = nullptr;
+  const SG::ThinningDecisionBase* dec_clusts = tcache ? tcache->thinning (key) : nullptr;
+
+  const size_t nClusters=trans->size();
+  if (nClusters>0) {
+    //we assume here all clusters in a container are built from the same cell container
+    m_linkCnv.transToPers((*trans)[0]->getCellContainerLink(),pers->m_cellCont,msg);
+    if (tcache) {
+      dec_cells = SG::getThinningDecision ((*trans)[0]->getCellContainerLink().dataID());
+    }
+  }
+
+  pers->m_nCellsPerCluster.reserve(nClusters);
+  //Cells (index, weight) of one cluster, sorted before encoding
+  std::vector<std::pair<unsigned, float> > cells;
+  size_t icluster = 0;
+  for(const CaloClusterCellLink* cccl: *trans) {
+    if (!dec_clusts || !dec_clusts->thinned (icluster)) {
+      const size_t nCells=cccl->size();
+      pers->m_nCellsPerCluster.push_back(nCells);
+      cells.clear();
+      cells.reserve(nCells);
+      CaloClusterCellLink::const_iterator it = cccl->begin();
+      CaloClusterCellLink::const_iterator end = cccl->end();
+      for (; it != end; ++it) {
+        unsigned ndx = it.index();
+        if (dec_cells) ndx = dec_cells->index (ndx);
+        // Reduce the precision first, so that weights rounded to 1.0
+        // are not stored and reading + rewriting gives the same result.
+        cells.emplace_back(ndx, m_compressor.reduceFloatPrecision(it.weight()));
+      }//end loop over cells in cellLink object
+      std::stable_sort(cells.begin(), cells.end(),
+                       [](const std::pair<unsigned, float>& a,
+                          const std::pair<unsigned, float>& b) { return a.first < b.first; });
+
+      pers->m_indexDeltas.reserve(pers->m_indexDeltas.size()+2*nCells);
+      unsigned lastIndex=0;
+      for (const std::pair<unsigned, float>& cell : cells) {
+        const uint32_t delta=cell.first-lastIndex;
+        lastIndex=cell.first;
+        if (cell.second == 1.0f) { //standard weight
+          putVarint(delta << 1, pers->m_indexDeltas);
+        }
+        else {
+          putVarint((delta << 1) | HAS_WEIGHT_BIT, pers->m_indexDeltas);
+          pers->m_weights.push_back(packWeight(cell.second));
+        }
+      }
+    }
+    ++icluster;
+  }//end loop over transient CaloClusterCellLinkContainer
+
+  return;
+}
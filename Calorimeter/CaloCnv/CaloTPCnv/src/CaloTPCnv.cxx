@@ -94,4 +94,11 @@ DECLARE_TPCNV_FACTORY(CaloCellContainerCnv_p1,
 DECLARE_TPCNV_FACTORY(CaloClusterCellLinkContainerCnv_p1,
                       CaloClusterCellLinkContainer,
                       CaloClusterCellLinkContainer_p1,
+                      Athena::TPCnvVers::Old)
+
+#include "CaloTPCnv/CaloClusterCellLinkContainerCnv_p2.h"
+
+DECLARE_TPCNV_FACTORY(CaloClusterCellLinkContainerCnv_p2,
+                      CaloClusterCellLinkContainer,
+                      CaloClusterCellLinkContainer_p2,
                       Athena::TPCnvVers::Current)
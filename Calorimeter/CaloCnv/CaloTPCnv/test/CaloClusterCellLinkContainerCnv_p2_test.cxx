@@ -0,0 +1,144 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/* @file CaloClusterCellLinkContainerCnv_p2_test.cxx
+ * @date Oct, 2022
+ * @brief Regression tests for CaloClusterCellLinkContainerCnv_p2.
+ */
+
+#undef NDEBUG
+#include "CaloTPCnv/CaloClusterCellLinkContainerCnv_p2.h"
+#include "CaloEvent/CaloClusterCellLinkContainer.h"
+#include "TestTools/leakcheck.h"
+#include "GaudiKernel/ThreadLocalContext.h"
+#include "CxxUtils/checker_macros.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+
+// Cells of a cluster sorted by index, as written by the converter.
+std::vector<std::pair<unsigned, double> > sortedCells (const CaloClusterCellLink& p)
+{
+  std::vector<std::pair<unsigned, double> > cells;
+  for (CaloClusterCellLink::const_iterator it = p.begin(); it != p.end(); ++it)
+    cells.emplace_back (it.index(), it.weight());
+  std::stable_sort (cells.begin(), cells.end(),
+                    [](const std::pair<unsigned, double>& a,
+                       const std::pair<unsigned, double>& b) { return a.first < b.first; });
+  return cells;
+}
+
+
+void compare (const CaloClusterCellLink& p1,
+              const CaloClusterCellLink& p2)
+{
+  assert (p1.getCellContainerLink() == p2.getCellContainerLink());
+  assert (p1.size() == p2.size());
+  if (p1.size() == 0) return;
+  std::vector<std::pair<unsigned, double> > cells1 = sortedCells (p1);
+  // Cells are read back in increasing index order.
+  CaloClusterCellLink::const_iterator it2 = p2.begin();
+  for (size_t i = 0; i < p1.size(); i++) {
+    assert (cells1[i].first == it2.index());
+    // Weights are stored with 8 significant bits.
+    assert (std::abs (cells1[i].second - it2.weight()) <= std::abs (cells1[i].second) * (1./256));
+    ++it2;
+  }
+}
+
+
+void compare (const CaloClusterCellLinkContainer& p1,
+              const CaloClusterCellLinkContainer& p2)
+{
+  assert (p1.size() == p2.size());
+  for (size_t i = 0; i < p1.size(); i++)
+    compare (*p1.at(i), *p2.at(i));
+}
+
+
+void testit (const CaloClusterCellLinkContainer& trans1)
+{
+  MsgStream log (0, "test");
+  CaloClusterCellLinkContainerCnv_p2 cnv;
+  CaloClusterCellLinkContainer_p2 pers;
+  cnv.transToPersWithKey (&trans1, &pers, "key", log);
+  CaloClusterCellLinkContainer trans2;
+  cnv.persToTransWithKey (&pers, &trans2, "key", log);
+  compare (trans1, trans2);
+
+  // Make sure that reading + rewriting doesn't change the persistent form.
+  CaloClusterCellLinkContainer_p2 pers2;
+  cnv.transToPersWithKey (&trans2, &pers2, "key", log);
+  assert (pers.m_indexDeltas == pers2.m_indexDeltas);
+  assert (pers.m_weights == pers2.m_weights);
+  assert (pers.m_nCellsPerCluster == pers2.m_nCellsPerCluster);
+  assert (pers.m_cellCont.m_SGKeyHash == pers2.m_cellCont.m_SGKeyHash);
+
+  std::cout << "  " << pers.m_indexDeltas.size() << " index bytes, "
+            << pers.m_weights.size() << " weights\n";
+}
+
+
+void test1 ATLAS_NOT_THREAD_SAFE ()
+{
+  std::cout << "test1\n";
+  (void)Gaudi::Hive::currentContext();
+  Athena_test::Leakcheck check;
+
+  CaloClusterCellLinkContainer trans1;
+  {
+    DataLink<CaloCellContainer> link ("cont1");
+    auto cccl = std::make_unique<CaloClusterCellLink> (link);
+    cccl->addCell (2, 1.5);
+    cccl->addCell (3, 2.5);
+    cccl->addCell (4, 1.0);
+    cccl->addCell (5, 1.0 - 1e-9);
+    trans1.push_back (std::move (cccl));
+  }
+  {
+    DataLink<CaloCellContainer> link ("cont2");
+    auto cccl = std::make_unique<CaloClusterCellLink> (link);
+    cccl->addCell (14, 13.5);
+    cccl->addCell (12, 11.5);
+    cccl->addCell (13, 12.5);
+    trans1.push_back (std::move (cccl));
+  }
+  {
+    DataLink<CaloCellContainer> link ("cont3");
+    auto cccl = std::make_unique<CaloClusterCellLink> (link);
+    trans1.push_back (std::move (cccl));
+  }
+  testit (trans1);
+}
+
+
+// Large, unordered index gaps and non-trivial weights.
+void test2 ATLAS_NOT_THREAD_SAFE ()
+{
+  std::cout << "test2\n";
+  Athena_test::Leakcheck check;
+
+  CaloClusterCellLinkContainer trans1;
+  DataLink<CaloCellContainer> link ("cont1");
+  auto cccl = std::make_unique<CaloClusterCellLink> (link);
+  cccl->addCell (187651, 0.5);
+  cccl->addCell (7, 1.0);
+  cccl->addCell (1000, 0.123456);
+  cccl->addCell (128, 1.0);
+  cccl->addCell (129, 0.5);
+  cccl->addCell (129+16384, 3.14159);
+  trans1.push_back (std::move (cccl));
+  testit (trans1);
+}
+
+
+int main ATLAS_NOT_THREAD_SAFE ()
+{
+  test1();
+  test2();
+  return 0;
+}
@@ -0,0 +1,118 @@
+// -*- c++ -*-
+/* Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration */
+
+#ifndef CALODETDESCR_CALOCELLROIINDEX_H
+#define CALODETDESCR_CALOCELLROIINDEX_H
+
+#include "Identifier/IdentifierHash.h"
+#include "CaloIdentifier/CaloCell_ID.h"
+#include "CaloGeoHelpers/CaloSampling.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class CaloDetDescrManager_Base;
+
+/**
+ * @class CaloCellRoIIndex
+ * @brief Eta-phi spatial index of calorimeter cells, one uniform grid per sampling.
+ *
+ * Cells are assigned to the grid bin containing their center. The bins of
+ * a sampling are stored contiguously (compressed row storage), together
+ * with copies of the cell centers, so that a query only touches the bins
+ * overlapping the requested window and the cells inside them.
+ *
+ * The queries return the hashes of all cells with their center inside the
+ * window (boundaries included), which is a superset of what @c CaloCellList
+ * selects with its strict cuts on the cell center.
+ *
+ * Built once per geometry IOV by @c CaloCellRoIIndexCondAlg.
+ */
+class CaloCellRoIIndex
+{
+public:
+  /**
+   * @brief Build the index.
+   * @param caloDDM  Calorimeter detector description manager.
+   * @param etaWidth Width of the grid bins in pseudorapidity.
+   * @param phiBins  Number of grid bins in azimuth.
+   */
+  CaloCellRoIIndex(const CaloDetDescrManager_Base* caloDDM,
+                   double etaWidth,
+                   unsigned int phiBins);
+
+  CaloCellRoIIndex() = delete;
+
+  /// @brief Cells of all samplings with center in the window.
+  void cellsInZone(double eta_min, double eta_max,
+                   double phi_min, double phi_max,
+                   std::vector<IdentifierHash>& cell_list) const;
+
+  /// @brief Cells of one subcalorimeter with center in the window.
+  void cellsInZone(double eta_min, double eta_max,
+                   double phi_min, double phi_max,
+                   CaloCell_ID::SUBCALO subCalo,
+                   std::vector<IdentifierHash>& cell_list) const;
+
+  /// @brief Cells of one sampling with center in the window.
+  void cellsInZone(double eta_min, double eta_max,
+                   double phi_min, double phi_max,
+                   CaloCell_ID::CaloSample sample,
+                   std::vector<IdentifierHash>& cell_list) const;
+
+  /// @brief Cells of one sampling with center inside a cone of size dR.
+  void cellsInCone(double eta, double phi, double dR,
+                   CaloCell_ID::CaloSample sample,
+                   std::vector<IdentifierHash>& cell_list) const;
+
+  /// @brief Number of indexed cells in a sampling.
+  size_t nCells(CaloCell_ID::CaloSample sample) const;
+
+  /// @brief Number of grid bins in azimuth.
+  unsigned int phiBins() const { return m_phiBins; }
+
+  /// @brief Width of the grid bins in pseudorapidity.
+  double etaWidth() const { return m_etaWidth; }
+
+private:
+  /// Grid for one sampling.
+  struct SamplingGrid
+  {
+    CaloCell_ID::SUBCALO subCalo = CaloCell_ID::NOT_VALID;
+    float etaMin = 0;
+    float etaMax = 0;
+    unsigned int etaBins = 0;
+    /// Offsets of the first cell of each bin in the arrays below (size nbins+1).
+    std::vector<uint32_t> offsets;
+    /// Cell hashes, ordered by bin.
+    std::vector<IdentifierHash> cells;
+    /// Cell centers, parallel to @c cells.
+    std::vector<float> eta;
+    std::vector<float> phi;
+  };
+
+  unsigned int etaBin(const SamplingGrid& grid, double eta) const;
+  unsigned int phiBin(double phi) const;
+
+  /// Append cells of one sampling with center in the window
+  /// and, if dR2 is not negative, inside the cone around the window center.
+  void addCellsInZone(const SamplingGrid& grid,
+                      double eta_min, double eta_max,
+                      double phi_min, double phi_max,
+                      std::vector<IdentifierHash>& cell_list,
+                      double dR2 = -1.) const;
+
+  double m_etaWidth;
+  unsigned int m_phiBins;
+  double m_phiWidth;
+
+  std::array<SamplingGrid, CaloSampling::getNumberOfSamplings()> m_grids;
+};
+
+#include "AthenaKernel/CLASS_DEF.h"
+CLASS_DEF( CaloCellRoIIndex, 209830861, 1 )
+#include "AthenaKernel/CondCont.h"
+CONDCONT_DEF( CaloCellRoIIndex, 86947095 );
+
+#endif // CALODETDESCR_CALOCELLROIINDEX_H
@@ -0,0 +1,18 @@
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.ComponentFactory import CompFactory
+
+
+def CaloCellRoIIndexCondAlgCfg(flags, name="CaloCellRoIIndexCondAlg", **kwargs):
+    """Eta-phi cell index (CaloCellRoIIndex) in the condition store,
+    to be used by CaloCellList through its setRoIIndex method"""
+    result = ComponentAccumulator()
+
+    from LArGeoAlgsNV.LArGMConfig import LArGMCfg
+    from TileGeoModel.TileGMConfig import TileGMCfg
+    result.merge(LArGMCfg(flags))
+    result.merge(TileGMCfg(flags))
+
+    result.addCondAlgo(CompFactory.CaloCellRoIIndexCondAlg(name, **kwargs))
+    return result
@@ -0,0 +1,204 @@
+/* Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration */
+
+#include "CaloDetDescr/CaloCellRoIIndex.h"
+#include "CaloDetDescr/CaloDetDescrManager.h"
+#include "CaloDetDescr/CaloDetDescrElement.h"
+#include "CaloGeoHelpers/CaloPhiRange.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+CaloCellRoIIndex::CaloCellRoIIndex(const CaloDetDescrManager_Base* caloDDM,
+                                   double etaWidth,
+                                   unsigned int phiBins)
+  : m_etaWidth(etaWidth > 0. ? etaWidth : 0.1),
+    m_phiBins(phiBins > 0 ? phiBins : 64),
+    m_phiWidth(CaloPhiRange::twopi() / m_phiBins)
+{
+  // First pass: pseudorapidity range of every sampling
+  for (const CaloDetDescrElement* elt : caloDDM->element_range()) {
+    if (!elt) continue;
+    unsigned int sam = elt->getSampling();
+    if (sam >= m_grids.size()) continue;
+    SamplingGrid& grid = m_grids[sam];
+    if (grid.subCalo == CaloCell_ID::NOT_VALID) {
+      grid.subCalo = elt->getSubCalo();
+      grid.etaMin = elt->eta();
+      grid.etaMax = elt->eta();
+    } else {
+      grid.etaMin = std::min(grid.etaMin, elt->eta());
+      grid.etaMax = std::max(grid.etaMax, elt->eta());
+    }
+  }
+
+  for (SamplingGrid& grid : m_grids) {
+    if (grid.subCalo == CaloCell_ID::NOT_VALID) continue;
+    grid.etaBins = std::max(1, static_cast<int>(std::ceil((grid.etaMax - grid.etaMin) / m_etaWidth)));
+    grid.offsets.assign(grid.etaBins * m_phiBins + 1, 0);
+  }
+
+  // Second pass: count cells per bin
+  for (const CaloDetDescrElement* elt : caloDDM->element_range()) {
+    if (!elt) continue;
+    unsigned int sam = elt->getSampling();
+    if (sam >= m_grids.size()) continue;
+    SamplingGrid& grid = m_grids[sam];
+    unsigned int bin = etaBin(grid, elt->eta()) * m_phiBins + phiBin(elt->phi());
+    ++grid.offsets[bin + 1];
+  }
+
+  for (SamplingGrid& grid : m_grids) {
+    if (grid.offsets.empty()) continue;
+    for (size_t i = 1; i < grid.offsets.size(); ++i) {
+      grid.offsets[i] += grid.offsets[i - 1];
+    }
+    grid.cells.resize(grid.offsets.back());
+    grid.eta.resize(grid.offsets.back());
+    grid.phi.resize(grid.offsets.back());
+  }
+
+  // Third pass: fill the bins
+  std::array<std::vector<uint32_t>, CaloSampling::getNumberOfSamplings()> next;
+  for (unsigned int sam = 0; sam < m_grids.size(); ++sam) {
+    next[sam] = m_grids[sam].offsets;
+  }
+
+  for (const CaloDetDescrElement* elt : caloDDM->element_range()) {
+    if (!elt) continue;
+    unsigned int sam = elt->getSampling();
+    if (sam >= m_grids.size()) continue;
+    SamplingGrid& grid = m_grids[sam];
+    unsigned int bin = etaBin(grid, elt->eta()) * m_phiBins + phiBin(elt->phi());
+    uint32_t idx = next[sam][bin]++;
+    grid.cells[idx] = elt->calo_hash();
+    grid.eta[idx] = elt->eta();
+    grid.phi[idx] = elt->phi();
+  }
+}
+
+
+unsigned int CaloCellRoIIndex::etaBin(const SamplingGrid& grid, double eta) const
+{
+  if (eta <= grid.etaMin) return 0;
+  unsigned int bin = static_cast<unsigned int>((eta - grid.etaMin) / m_etaWidth);
+  return std::min(bin, grid.etaBins - 1);
+}
+
+
+unsigned int CaloCellRoIIndex::phiBin(double phi) const
+{
+  double dphi = CaloPhiRange::fix(phi) - CaloPhiRange::phi_min();
+  if (dphi <= 0.) return 0;
+  unsigned int bin = static_cast<unsigned int>(dphi / m_phiWidth);
+  return std::min(bin, m_phiBins - 1);
+}
+
+
+void CaloCellRoIIndex::addCellsInZone(const SamplingGrid& grid,
+                                      double eta_min, double eta_max,
+                                      double phi_min, double phi_max,
+                                      std::vector<IdentifierHash>& cell_list,
+                                      double dR2 /*= -1*/) const
+{
+  if (grid.cells.empty()) return;
+  if (eta_max < grid.etaMin || eta_min > grid.etaMax) return;
+
+  unsigned int ieta_min = etaBin(grid, eta_min);
+  unsigned int ieta_max = etaBin(grid, eta_max);
+
+  // Azimuthal window is described by its center and half-width,
+  // so that the wrap-around at +-pi needs no special treatment.
+  double phi_half = 0.5 * (phi_max - phi_min);
+  double phi_center = CaloPhiRange::fix(phi_min + phi_half);
+
+  unsigned int iphi_first = 0;
+  unsigned int nphi = m_phiBins;
+  if (2. * phi_half + 2. * m_phiWidth < CaloPhiRange::twopi()) {
+    iphi_first = phiBin(phi_min);
+    unsigned int iphi_last = phiBin(phi_max);
+    nphi = (iphi_last + m_phiBins - iphi_first) % m_phiBins + 1;
+  }
+
+  for (unsigned int ieta = ieta_min; ieta <= ieta_max; ++ieta) {
+    for (unsigned int k = 0; k < nphi; ++k) {
+      unsigned int bin = ieta * m_phiBins + (iphi_first + k) % m_phiBins;
+      for (uint32_t idx = grid.offsets[bin]; idx < grid.offsets[bin + 1]; ++idx) {
+        if (grid.eta[idx] < eta_min || grid.eta[idx] > eta_max) continue;
+        double dphi = CaloPhiRange::diff(grid.phi[idx], phi_center);
+        if (std::abs(dphi) > phi_half) continue;
+        if (dR2 >= 0.) {
+          // cone around the window center
+          double deta = grid.eta[idx] - 0.5 * (eta_min + eta_max);
+          if (deta * deta + dphi * dphi > dR2) continue;
+        }
+        cell_list.push_back(grid.cells[idx]);
+      }
+    }
+  }
+}
+
+
+void CaloCellRoIIndex::cellsInZone(double eta_min, double eta_max,
+                                   double phi_min, double phi_max,
+                                   std::vector<IdentifierHash>& cell_list) const
+{
+  cell_list.clear();
+  if ( eta_min >= eta_max ) return;
+  if ( phi_min >= phi_max ) return;
+
+  for (const SamplingGrid& grid : m_grids) {
+    addCellsInZone(grid, eta_min, eta_max, phi_min, phi_max, cell_list);
+  }
+}
+
+
+void CaloCellRoIIndex::cellsInZone(double eta_min, double eta_max,
+                                   double phi_min, double phi_max,
+                                   CaloCell_ID::SUBCALO subCalo,
+                                   std::vector<IdentifierHash>& cell_list) const
+{
+  cell_list.clear();
+  if ( eta_min >= eta_max ) return;
+  if ( phi_min >= phi_max ) return;
+
+  for (const SamplingGrid& grid : m_grids) {
+    if (grid.subCalo == subCalo) {
+      addCellsInZone(grid, eta_min, eta_max, phi_min, phi_max, cell_list);
+    }
+  }
+}
+
+
+void CaloCellRoIIndex::cellsInZone(double eta_min, double eta_max,
+                                   double phi_min, double phi_max,
+                                   CaloCell_ID::CaloSample sample,
+                                   std::vector<IdentifierHash>& cell_list) const
+{
+  cell_list.clear();
+  if ( eta_min >= eta_max ) return;
+  if ( phi_min >= phi_max ) return;
+  if ( static_cast<unsigned int>(sample) >= m_grids.size() ) return;
+
+  addCellsInZone(m_grids[sample], eta_min, eta_max, phi_min, phi_max, cell_list);
+}
+
+
+void CaloCellRoIIndex::cellsInCone(double eta, double phi, double dR,
+                                   CaloCell_ID::CaloSample sample,
+                                   std::vector<IdentifierHash>& cell_list) const
+{
+  cell_list.clear();
+  if ( dR <= 0. ) return;
+  if ( static_cast<unsigned int>(sample) >= m_grids.size() ) return;
+
+  addCellsInZone(m_grids[sample], eta - dR, eta + dR, phi - dR, phi + dR, cell_list,
+                 dR * dR);
+}
+
+
+size_t CaloCellRoIIndex::nCells(CaloCell_ID::CaloSample sample) const
+{
+  if ( static_cast<unsigned int>(sample) >= m_grids.size() ) return 0;
+  return m_grids[sample].cells.size();
+}
@@ -0,0 +1,37 @@
+//Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+
+#include "CaloCellRoIIndexCondAlg.h"
+#include <memory>
+
+
+StatusCode CaloCellRoIIndexCondAlg::initialize() {
+
+  ATH_CHECK(m_caloMgrKey.initialize());
+
+  ATH_CHECK(m_outputKey.initialize());
+
+  return StatusCode::SUCCESS;
+}
+
+
+StatusCode CaloCellRoIIndexCondAlg::execute(const EventContext& ctx) const {
+
+  //Set up write handle
+  SG::WriteCondHandle<CaloCellRoIIndex> writeHandle{m_outputKey,ctx};
+  if (writeHandle.isValid()) {
+    ATH_MSG_DEBUG("Found valid write handle");
+    return StatusCode::SUCCESS;
+  }
+
+  SG::ReadCondHandle<CaloDetDescrManager> caloMgrHandle{m_caloMgrKey,ctx};
+  const CaloDetDescrManager* caloDDM = *caloMgrHandle;
+
+  writeHandle.addDependency(caloMgrHandle);
+
+  auto index = std::make_unique<CaloCellRoIIndex>(caloDDM, m_etaWidth, m_phiBins);
+
+  ATH_CHECK(writeHandle.record(std::move(index)));
+  ATH_MSG_INFO("recorded new CaloCellRoIIndex object with key " << writeHandle.key() << " and range " << writeHandle.getRange());
+
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,39 @@
+//Dear emacs, this is -*-c++-*-
+//Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+
+#ifndef CALODETDESC_CALOCELLROIINDEXCONDALG_H
+#define CALODETDESC_CALOCELLROIINDEXCONDALG_H
+
+#include "AthenaBaseComps/AthReentrantAlgorithm.h"
+#include "StoreGate/ReadCondHandleKey.h"
+#include "StoreGate/WriteCondHandleKey.h"
+#include "CaloDetDescr/CaloCellRoIIndex.h"
+#include "CaloDetDescr/CaloDetDescrManager.h"
+
+/**
+ * @class CaloCellRoIIndexCondAlg
+ * @brief Builds the per-sampling eta-phi cell index (CaloCellRoIIndex)
+ *        from the CaloDetDescrManager conditions object.
+ */
+class CaloCellRoIIndexCondAlg : public AthReentrantAlgorithm {
+
+ public:
+  using AthReentrantAlgorithm::AthReentrantAlgorithm;
+  virtual ~CaloCellRoIIndexCondAlg() = default;
+
+  StatusCode initialize() override final;
+  StatusCode execute(const EventContext& ctx) const override final;
+  StatusCode finalize() override final {return StatusCode::SUCCESS;}
+  virtual bool isReEntrant() const override final { return false; }
+
+ private:
+
+  SG::ReadCondHandleKey<CaloDetDescrManager> m_caloMgrKey{this,"CaloDetDescrManager", "CaloDetDescrManager"};
+  SG::WriteCondHandleKey<CaloCellRoIIndex> m_outputKey{this,"OutputKey","CaloCellRoIIndex"};
+
+  //Properties:
+  Gaudi::Property<double> m_etaWidth{this,"EtaBinWidth",0.05,"Width of index bins in pseudorapidity"};
+  Gaudi::Property<unsigned> m_phiBins{this,"PhiBins",128,"Number of index bins in azimuth"};
+
+};
+#endif
@@ -2,8 +2,10 @@
 #include "CaloDetDescr/CaloDepthTool.h"
 #include "../CaloSuperCellIDTool.h"
 #include "../CaloTowerGeometryCondAlg.h"
+#include "../CaloCellRoIIndexCondAlg.h"
 
 DECLARE_COMPONENT( CaloDepthTool )
 DECLARE_COMPONENT( CaloSuperCellIDTool )
 DECLARE_COMPONENT( CaloTowerGeometryCondAlg )
+DECLARE_COMPONENT( CaloCellRoIIndexCondAlg )
 
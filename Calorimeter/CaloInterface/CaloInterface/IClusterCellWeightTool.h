@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 //Dear emacs, this is -*-c++--*-
@@ -14,11 +14,16 @@
  *
  * Each CellWeight tool has to derive from this class and provide
  * the method: weight(CaloCluster*) which should loop over the cluster
- * constituents and weight them. */
+ * constituents and weight them. Tools with sizeable per-event setup
+ * (conditions lookups, tables) can in addition override
+ * weightClusters(), which is called once for all selected clusters
+ * of an event. */
 
 #include "GaudiKernel/IAlgTool.h"
 #include "xAODCaloEvent/CaloClusterFwd.h"
 
+#include <vector>
+
 class EventContext;
 
 class IClusterCellWeightTool : virtual public IAlgTool
@@ -39,6 +44,23 @@ class IClusterCellWeightTool : virtual public IAlgTool
    * to implement it.  */
   virtual StatusCode weight(xAOD::CaloCluster* thisCluster, const EventContext& ctx) const = 0;
 
+  /**
+   * @brief method to weight the cells of several clusters of one event
+   * @param clusters the clusters to be weighted
+   *
+   * The default implementation calls weight() for every cluster. All
+   * clusters are processed even if one of them fails, in which case
+   * FAILURE is returned at the end. */
+  virtual StatusCode weightClusters(const std::vector<xAOD::CaloCluster*>& clusters,
+                                    const EventContext& ctx) const
+  {
+    StatusCode sc = StatusCode::SUCCESS;
+    for (xAOD::CaloCluster* cluster : clusters) {
+      if (weight(cluster, ctx).isFailure()) sc = StatusCode::FAILURE;
+    }
+    return sc;
+  }
+
 };
 #endif
 
@@ -247,6 +247,36 @@ StatusCode CaloClusterMomentsMaker::initialize()
   // sort and remove duplicates
   std::sort(m_validMoments.begin(), m_validMoments.end());
   m_validMoments.erase(std::unique(m_validMoments.begin(),m_validMoments.end()),m_validMoments.end());
+
+  // find the moments summed over cells and those depending on the shower axis
+  for (size_t iMoment = 0; iMoment != m_validMoments.size(); ++iMoment) {
+    switch (m_validMoments[iMoment]) {
+    case xAOD::CaloCluster::SECOND_R:
+    case xAOD::CaloCluster::SECOND_LAMBDA:
+    case xAOD::CaloCluster::LATERAL:
+    case xAOD::CaloCluster::LONGITUDINAL:
+      m_calculateShowerAxis = true;
+      m_cellMoments.push_back(iMoment);
+      break;
+    case xAOD::CaloCluster::FIRST_ETA:
+    case xAOD::CaloCluster::FIRST_PHI:
+    case xAOD::CaloCluster::FIRST_ENG_DENS:
+    case xAOD::CaloCluster::SECOND_ENG_DENS:
+    case xAOD::CaloCluster::ENG_FRAC_EM:
+    case xAOD::CaloCluster::ENG_FRAC_MAX:
+    case xAOD::CaloCluster::PTD:
+      m_cellMoments.push_back(iMoment);
+      break;
+    case xAOD::CaloCluster::DELTA_PHI:
+    case xAOD::CaloCluster::DELTA_THETA:
+    case xAOD::CaloCluster::DELTA_ALPHA:
+    case xAOD::CaloCluster::CENTER_LAMBDA:
+      m_calculateShowerAxis = true;
+      break;
+    default:
+      break;
+    }
+  }
    
   // print configured moments
   ATH_MSG_INFO( "Construct and save " << nmom << " cluster moments: " );
@@ -592,7 +622,7 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
 	// property m_maxAxisAngle
 
 	double angle(0),deltaPhi(0),deltaTheta(0);
-	if ( ncell > 2 ) {
+	if ( m_calculateShowerAxis && ncell > 2 ) {
 	  Eigen::Matrix3d C=Eigen::Matrix3d::Zero();
 	  for(i=0;i<ncell;i++) {
             const CaloClusterMomentsMaker_detail::cellinfo& ci = cellinfo[i];
@@ -678,7 +708,8 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
 	// along the shower axis for each cell. The cluster center is 
 	// at r=0 and lambda=0
 	
-	for (auto& ci : cellinfo) {
+	for(i=0; m_calculateShowerAxis && i<ncell; i++) {
+	  CaloClusterMomentsMaker_detail::cellinfo& ci = cellinfo[i];
 	  const Amg::Vector3D currentCell(ci.x,ci.y,ci.z);
 	  // calculate distance from shower axis r
 	  ci.r = ((currentCell-showerCenter).cross(showerAxis)).mag();
@@ -696,9 +727,7 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
 	  const CaloClusterMomentsMaker_detail::cellinfo& ci = cellinfo[i];
 	  // loop over all valid moments
 	  commonNorm += ci.energy;
- 	  for(size_t iMoment = 0, size = m_validMoments.size();
-              iMoment != size;
-              ++ iMoment)
+ 	  for (size_t iMoment : m_cellMoments)
           {
 	    // now calculate the actual moments
 	    switch (m_validMoments[iMoment]) {
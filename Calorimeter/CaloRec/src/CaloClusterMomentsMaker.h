@@ -1,6 +1,6 @@
 
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 //Dear emacs, this is -*-c++-*-
@@ -76,6 +76,21 @@ class CaloClusterMomentsMaker: public AthAlgTool, virtual public CaloClusterColl
    * valid moment names (m_validNames). */
   std::vector<xAOD::CaloCluster::MomentType> m_validMoments;
 
+  /**
+   * @brief indices in m_validMoments of the moments which are summed
+   * over the positive energy cells.
+   *
+   * Only these moments are visited in the loop over the cells. */
+  std::vector<size_t> m_cellMoments;
+
+  /**
+   * @brief set to true if any requested moment needs the shower axis.
+   *
+   * The principal axis (eigen-decomposition of the energy weighted
+   * covariance matrix) and the distances of the cells from the shower
+   * center are only calculated in this case. */
+  bool m_calculateShowerAxis = { false };
+
   const CaloCell_ID* m_calo_id;
 
   /** @brief the maximal allowed deviation from the
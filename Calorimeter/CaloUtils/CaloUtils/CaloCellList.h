@@ -29,10 +29,15 @@
                                  (ncell_eta,ncell_phi) specified. The List of cells replaced
                                  by the Vector of cells.
 
+   Mod 2022: optional CaloCellRoIIndex (conditions object) used instead of the
+             CaloDetDescrManager region lookup, so that only the cells in the
+             eta-phi bins overlapping the window are tested.
+
 */
 
 class CaloCellContainer;
 class CaloCell;
+class CaloCellRoIIndex;
 #include "CaloDetDescr/CaloDetDescrManager.h"
 #include "CaloIdentifier/CaloCell_ID.h"
 
@@ -49,6 +54,10 @@ public:
 
   ~CaloCellList() = default;
 
+  // Use the eta-phi cell index for the following selections (nullptr to
+  // go back to the CaloDetDescrManager lookup).
+  void setRoIIndex(const CaloCellRoIIndex* index) { m_index = index; }
+
   // deta/dphi are the half-widths of the window.
   // That is, we select cells within eta-deta .. eta+deta and similarly for
   // phi.
@@ -76,6 +85,7 @@ private:
 
   const CaloCellContainer* m_cellcont;
   const CaloDetDescrManager* m_mgr;
+  const CaloCellRoIIndex* m_index = nullptr;
   std::vector<CaloCell_ID::SUBCALO> m_caloNums;
   vector_type m_theCellVector;
   double m_energy;
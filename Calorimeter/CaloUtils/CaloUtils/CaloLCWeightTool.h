@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOUTILS_CALOLCWEIGHTTOOL_H
@@ -38,6 +38,8 @@ class CaloLCWeightTool : public AthAlgTool, virtual public IClusterCellWeightToo
   virtual ~CaloLCWeightTool();
 
   virtual StatusCode weight(xAOD::CaloCluster* theCluster, const EventContext& ctx) const override;
+  virtual StatusCode weightClusters(const std::vector<xAOD::CaloCluster*>& clusters,
+                                    const EventContext& ctx) const override;
   virtual StatusCode initialize() override;
 
   CaloLCWeightTool(const std::string& type, 
@@ -45,6 +47,22 @@ class CaloLCWeightTool : public AthAlgTool, virtual public IClusterCellWeightToo
 		   const IInterface* parent);
  private:
 
+  /**
+   * @brief conditions data and lookups which are the same for all clusters of an event */
+  struct EventData
+  {
+    const CaloLocalHadCoeff* data = nullptr;
+    const CaloNoise* noise = nullptr;
+    /// area index in data for each sampling (-1 if not weighted)
+    std::vector<int> isAmpMap;
+    /// upper limit of log10(cluster energy) for each area
+    std::vector<double> lemax;
+  };
+
+  StatusCode prepareEventData(const EventContext& ctx, EventData& evt) const;
+
+  StatusCode weightCluster(xAOD::CaloCluster* theCluster, const EventData& evt) const;
+
   /**
    * @brief name of the key for had cell weights */
   SG::ReadCondHandleKey<CaloLocalHadCoeff> m_key;
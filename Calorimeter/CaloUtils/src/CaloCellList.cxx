@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 // Given an input eta,phi, deta,dphi - this class will return you
@@ -11,6 +11,7 @@
 
 #include "CaloUtils/CaloCellList.h"
 #include "CaloDetDescr/CaloDetDescrManager.h"
+#include "CaloDetDescr/CaloCellRoIIndex.h"
 #include "CaloEvent/CaloCell.h"
 #include "CaloEvent/CaloCellContainer.h"
 #include "CaloGeoHelpers/CaloSampling.h"
@@ -112,7 +113,21 @@ CaloCellList::doSelect(double eta,
 
   for (; itrCaloNum != itrEndCaloNum; ++itrCaloNum) {
     CaloCell_ID::SUBCALO caloNum = *itrCaloNum;
-    if (sam != CaloCell_ID::Unknown) {
+    if (m_index) {
+      if (sam != CaloCell_ID::Unknown) {
+        if (dR > 0)
+          m_index->cellsInCone(eta, phi, dR, sam, calo_mgr_vect);
+        else
+          m_index->cellsInZone(eta - deta, eta + deta, phi - dphi, phi + dphi, sam, calo_mgr_vect);
+        itrCaloNum = itrEndCaloNum - 1;
+      } else if (caloNum == CaloCell_ID::NSUBCALO) {
+        m_index->cellsInZone(eta - deta, eta + deta, phi - dphi, phi + dphi, calo_mgr_vect);
+      } else if (caloNum != CaloCell_ID::NOT_VALID) {
+        m_index->cellsInZone(eta - deta, eta + deta, phi - dphi, phi + dphi, caloNum, calo_mgr_vect);
+      } else {
+        continue;
+      }
+    } else if (sam != CaloCell_ID::Unknown) {
       m_mgr->cellsInZone(eta - deta, eta + deta, phi - dphi, phi + dphi, sam, calo_mgr_vect);
       itrCaloNum = itrEndCaloNum - 1;
     } else if (caloNum == CaloCell_ID::NSUBCALO) {
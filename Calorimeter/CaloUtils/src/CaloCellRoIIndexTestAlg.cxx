@@ -0,0 +1,152 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file  CaloCellRoIIndexTestAlg.cxx
+ * @date Oct, 2022
+ * @brief Regression test for CaloCellRoIIndex: CaloCellList must select
+ *        the same cells with and without the index.
+ */
+
+#undef NDEBUG
+
+
+#include "CaloCellRoIIndexTestAlg.h"
+#include "CaloUtils/CaloCellList.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "AthenaKernel/errorcheck.h"
+#include "TestTools/random.h"
+#include "CLHEP/Units/SystemOfUnits.h"
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+
+using CLHEP::GeV;
+
+
+/** 
+ * @brief Standard Gaudi initialize method.
+ */
+StatusCode CaloCellRoIIndexTestAlg::initialize()
+{
+  ATH_CHECK( m_caloMgrKey.initialize() );
+  ATH_CHECK( m_indexKey.initialize() );
+  return StatusCode::SUCCESS;
+}
+
+
+CaloCellContainer*
+CaloCellRoIIndexTestAlg::make_cells (const CaloDetDescrManager& ddman)
+{
+  CaloCellContainer* cells = new CaloCellContainer;
+  for (const CaloDetDescrElement* dde : ddman.element_range()) {
+    if (!dde) continue;
+    float energy = Athena_test::randf_seed (m_seed, 10*GeV);
+    cells->push_back (new CaloCell (dde, energy, 0, 0, 0,
+                                    CaloGain::LARMEDIUMGAIN) );
+  }
+  cells->order();
+  cells->updateCaloIterators();
+  return cells;
+}
+
+
+bool CaloCellRoIIndexTestAlg::compare (const char* what,
+                                       double eta, double phi,
+                                       double deta, double dphi,
+                                       const CaloCellList& l1,
+                                       const CaloCellList& l2) const
+{
+  // The index returns the cells in a different order.
+  std::vector<unsigned int> h1;
+  for (const CaloCell* cell : l1) h1.push_back (cell->caloDDE()->calo_hash());
+  std::vector<unsigned int> h2;
+  for (const CaloCell* cell : l2) h2.push_back (cell->caloDDE()->calo_hash());
+  std::sort (h1.begin(), h1.end());
+  std::sort (h2.begin(), h2.end());
+  if (h1 != h2) {
+    std::cout << "Cell list mismatch " << what << " "
+              << eta << " " << phi << " " << deta << " " << dphi << " "
+              << h1.size() << " " << h2.size() << "\n";
+    return false;
+  }
+  return true;
+}
+
+
+StatusCode CaloCellRoIIndexTestAlg::test1()
+{
+  std::cout << "test1\n";
+
+  const EventContext& ctx = Gaudi::Hive::currentContext();
+
+  SG::ReadCondHandle<CaloDetDescrManager> caloMgrHandle{m_caloMgrKey, ctx};
+  assert (caloMgrHandle.isValid());
+  const CaloDetDescrManager* ddman = *caloMgrHandle;
+  SG::ReadCondHandle<CaloCellRoIIndex> indexHandle{m_indexKey, ctx};
+  assert (indexHandle.isValid());
+
+  const CaloCellContainer* cells = make_cells (*ddman);
+  CHECK( evtStore()->record (cells, "AllCalo") );
+
+  const std::vector<std::vector<CaloCell_ID::SUBCALO> > caloNumsList {
+    { CaloCell_ID::NSUBCALO },
+    { CaloCell_ID::LAREM },
+    { CaloCell_ID::LARHEC, CaloCell_ID::TILE },
+    { CaloCell_ID::LARFCAL },
+  };
+
+  size_t nselected = 0;
+  size_t nbad = 0;
+  for (int itry = 0; itry < 1000; itry++) {
+    const double eta = Athena_test::randf_seed (m_seed, 5.5, -5.5);
+    // every fourth window is centred close to the phi = +-pi boundary
+    const double phi = (itry % 4 == 0) ?
+      Athena_test::randf_seed (m_seed, M_PI + 0.1, M_PI - 0.1) :
+      Athena_test::randf_seed (m_seed, M_PI, -M_PI);
+    const double deta = Athena_test::randf_seed (m_seed, 0.5, 0.01);
+    const double dphi = Athena_test::randf_seed (m_seed, 0.5, 0.01);
+    const int sam = Athena_test::randi_seed (m_seed, CaloCell_ID::Unknown);
+
+    for (const std::vector<CaloCell_ID::SUBCALO>& caloNums : caloNumsList) {
+      CaloCellList l1 (ddman, cells, caloNums);
+      CaloCellList l2 (ddman, cells, caloNums);
+      l2.setRoIIndex (*indexHandle);
+
+      l1.select (eta, phi, deta, dphi);
+      l2.select (eta, phi, deta, dphi);
+      if (!compare ("window", eta, phi, deta, dphi, l1, l2)) ++nbad;
+      nselected += l1.ncells();
+
+      l1.select (eta, phi, deta);
+      l2.select (eta, phi, deta);
+      if (!compare ("cone", eta, phi, deta, deta, l1, l2)) ++nbad;
+
+      l1.select (eta, phi, deta, dphi, sam);
+      l2.select (eta, phi, deta, dphi, sam);
+      if (!compare ("sampling window", eta, phi, deta, dphi, l1, l2)) ++nbad;
+
+      l1.select (eta, phi, deta, sam);
+      l2.select (eta, phi, deta, sam);
+      if (!compare ("sampling cone", eta, phi, deta, deta, l1, l2)) ++nbad;
+    }
+  }
+
+  // Make sure the comparison is not trivial.
+  assert (nselected > 0);
+  assert (nbad == 0);
+
+  return StatusCode::SUCCESS;
+}
+
+
+/** 
+ * @brief Standard Gaudi execute method.
+ */
+StatusCode CaloCellRoIIndexTestAlg::execute()
+{
+  CHECK( test1() );
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,69 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloCellRoIIndexTestAlg.h
+ * @date Oct, 2022
+ * @brief Regression test for CaloCellRoIIndex: CaloCellList must select
+ *        the same cells with and without the index.
+ */
+
+
+#ifndef CALOUTILS_CALOCELLROIINDEXTESTALG_H
+#define CALOUTILS_CALOCELLROIINDEXTESTALG_H
+
+
+#include "AthenaBaseComps/AthAlgorithm.h"
+#include "CaloDetDescr/CaloDetDescrManager.h"
+#include "CaloDetDescr/CaloCellRoIIndex.h"
+#include "CaloIdentifier/CaloCell_ID.h"
+#include "StoreGate/ReadCondHandleKey.h"
+#include <cstdint>
+#include <vector>
+class CaloCellContainer;
+class CaloCellList;
+
+
+class CaloCellRoIIndexTestAlg
+  : public AthAlgorithm
+{
+public:
+  using AthAlgorithm::AthAlgorithm;
+
+
+  /** 
+   * @brief Standard Gaudi initialize method.
+   */
+  virtual StatusCode initialize() override;
+
+
+  /** 
+   * @brief Standard Gaudi execute method.
+   */
+  virtual StatusCode execute() override;
+
+
+private:
+  CaloCellContainer* make_cells (const CaloDetDescrManager& ddman);
+  bool compare (const char* what,
+                double eta, double phi, double deta, double dphi,
+                const CaloCellList& l1, const CaloCellList& l2) const;
+  StatusCode test1();
+
+  SG::ReadCondHandleKey<CaloDetDescrManager> m_caloMgrKey { this
+      , "CaloDetDescrManager"
+      , "CaloDetDescrManager"
+      , "SG Key for CaloDetDescrManager in the Condition Store" };
+  SG::ReadCondHandleKey<CaloCellRoIIndex> m_indexKey { this
+      , "CaloCellRoIIndex"
+      , "CaloCellRoIIndex"
+      , "SG Key for CaloCellRoIIndex in the Condition Store" };
+
+  uint32_t m_seed = 1;
+};
+
+
+
+
+#endif // not CALOUTILS_CALOCELLROIINDEXTESTALG_H
@@ -29,6 +29,8 @@
 #include "CaloIdentifier/CaloCell_ID.h"
 #include "xAODCaloEvent/CaloClusterKineHelper.h"
 
+#include <utility>
+
 CaloLCWeightTool::CaloLCWeightTool(const std::string& type,
 				   const std::string& name,
 				   const IInterface* parent)
@@ -90,36 +92,64 @@ StatusCode CaloLCWeightTool::initialize()
   return StatusCode::SUCCESS;
 }
 
-StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventContext& ctx) const
+StatusCode CaloLCWeightTool::prepareEventData(const EventContext& ctx, EventData& evt) const
 {
-  const CaloLocalHadCoeff* data(nullptr);
   SG::ReadCondHandle<CaloLocalHadCoeff> rch(m_key, ctx);
 
   SG::ReadCondHandle<CaloNoise> noiseHdl{m_noiseCDOKey,ctx};
-  const CaloNoise* noiseCDO=*noiseHdl;
+  evt.noise=*noiseHdl;
 
-  data = *rch;
-  if(data==nullptr) {
+  evt.data = *rch;
+  if(evt.data==nullptr) {
     ATH_MSG_ERROR("Unable to access conditions object");
     return StatusCode::FAILURE;
   }
-  // this is not super effective, but try to put is here first, and optimize later
-  std::vector<int> isAmpMap(CaloSampling::Unknown,-1);
-  for (int iArea=0;iArea<data->getSizeAreaSet();iArea++) {
+  evt.isAmpMap.assign(CaloSampling::Unknown,-1);
+  evt.lemax.assign(evt.data->getSizeAreaSet(),0);
+  for (int iArea=0;iArea<evt.data->getSizeAreaSet();iArea++) {
     for (int iSamp=0;iSamp<CaloSampling::Unknown;iSamp++) {
-      if ( m_sampnames[iSamp] == data->getArea(iArea)->getTitle() ) {
+      if ( m_sampnames[iSamp] == evt.data->getArea(iArea)->getTitle() ) {
         ATH_MSG_DEBUG("Found Area for Sampling " << CaloSamplingHelper::getSamplingName((CaloSampling::CaloSample)iSamp));
-        isAmpMap[iSamp] = iArea;
+        evt.isAmpMap[iSamp] = iArea;
+        const CaloLocalHadCoeff::LocalHadDimension *logeDim = evt.data->getArea(iArea)->getDimension(3);
+        evt.lemax[iArea] = logeDim->getXmax()-0.5*logeDim->getDx();
         break;
       }
     }
   }
+  return StatusCode::SUCCESS;
+}
+
+StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventContext& ctx) const
+{
+  EventData evt;
+  ATH_CHECK( prepareEventData(ctx, evt) );
+  return weightCluster(theCluster, evt);
+}
+
+StatusCode CaloLCWeightTool::weightClusters(const std::vector<xAOD::CaloCluster*>& clusters,
+                                            const EventContext& ctx) const
+{
+  // conditions and area lookup are done once for all clusters of the event
+  EventData evt;
+  ATH_CHECK( prepareEventData(ctx, evt) );
+  StatusCode sc = StatusCode::SUCCESS;
+  for (xAOD::CaloCluster* theCluster : clusters) {
+    if (weightCluster(theCluster, evt).isFailure()) sc = StatusCode::FAILURE;
+  }
+  return sc;
+}
+
+StatusCode CaloLCWeightTool::weightCluster(xAOD::CaloCluster *theCluster, const EventData& evt) const
+{
+  const CaloLocalHadCoeff* data = evt.data;
+  const CaloNoise* noiseCDO = evt.noise;
+  const std::vector<int>& isAmpMap = evt.isAmpMap;
 
   double eEM = theCluster->e();
 
   std::vector<float> vars(5);
 
-  CaloLCCoeffHelper hp;
   CaloLocalHadCoeff::LocalHadCoeff parint;
 
   double pi0Prob = 0;
@@ -137,15 +167,22 @@ StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventCo
     pi0Prob = 1;
 
   if ( eEM > 0 ) {
-    // loop over all cells
-    
+    const double log10eEM = log10(eEM);
+
+    // First pass: look up the hadronic weights and collect the new cell
+    // weights, second pass: apply them to the cluster.
+    std::vector<std::pair<size_t,double> > newWeights;
+    newWeights.reserve(theCluster->size());
+    size_t iCell = 0;
+
     xAOD::CaloCluster::cell_iterator itrCell = theCluster->cell_begin();
     xAOD::CaloCluster::cell_iterator itrCellEnd = theCluster->cell_end();
-    for (;itrCell!=itrCellEnd; ++itrCell) {
+    for (;itrCell!=itrCellEnd; ++itrCell, ++iCell) {
       CaloPrefetch::nextDDE(itrCell, itrCellEnd);
       // check calo and sampling index for current cell
-      Identifier myId = itrCell->ID();
-      CaloCell_ID::CaloSample theSample = CaloCell_ID::CaloSample(m_calo_id->calo_sample(myId));
+      const CaloDetDescrElement* myCDDE = itrCell->caloDDE();
+      CaloCell_ID::CaloSample theSample = myCDDE ? myCDDE->getSampling()
+        : CaloCell_ID::CaloSample(m_calo_id->calo_sample(itrCell->ID()));
       if ( isAmpMap[theSample] >= 0 ) {
 	double sigma =  noiseCDO->getNoise(itrCell->ID(),itrCell->gain());
 	double energy = fabs(itrCell->e());
@@ -155,7 +192,6 @@ StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventCo
 	if ( ratio > m_signalOverNoiseCut ) {
 	  double volume = 0;
 	  double density = 0;
-          const CaloDetDescrElement* myCDDE = itrCell->caloDDE();
 	  if ( myCDDE ) {
 	    volume = myCDDE->volume();
 	  }
@@ -164,9 +200,8 @@ StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventCo
 	  if ( density > 0 ) {
 	    double abseta = fabs(itrCell->eta());
 	    double log10edens = log10(density);
-	    double log10cluse = log10(eEM);
-	    const CaloLocalHadCoeff::LocalHadDimension *logeDim = data->getArea(isAmpMap[theSample])->getDimension(3);
-	    double lemax = logeDim->getXmax()-0.5*logeDim->getDx();
+	    double log10cluse = log10eEM;
+	    double lemax = evt.lemax[isAmpMap[theSample]];
 	    if ( log10cluse > lemax ) log10cluse = lemax;
 
             vars[CaloLocalHadDefs::DIMW_SIDE] = static_cast<float> ((itrCell->eta()<0?-1.0:1.0));
@@ -207,13 +242,20 @@ StatusCode CaloLCWeightTool::weight(xAOD::CaloCluster *theCluster, const EventCo
 			    << wData);
               double weight = itrCell.weight();//theCluster->getCellWeight(itrCell); // fastest!
               weight *= (pi0Prob + (1-pi0Prob)*wData);
-              // reweight cell in cluster
-              theCluster->reweightCell(itrCell,weight);
+              newWeights.emplace_back(iCell,weight);
             }
 	  } // density
 	} // noise cut
       } // sampling
     } // itrCell
+
+    // reweight cells in cluster
+    itrCell = theCluster->cell_begin();
+    iCell = 0;
+    for (const std::pair<size_t,double>& w : newWeights) {
+      for (; iCell < w.first; ++iCell) ++itrCell;
+      theCluster->reweightCell(itrCell,w.second);
+    }
     CaloClusterKineHelper::calculateKine(theCluster,true,m_updateSamplingVars);
   } // eEM
 
@@ -0,0 +1,171 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file  CaloLCWeightToolTestAlg.cxx
+ * @date Oct, 2022
+ * @brief Regression test for CaloLCWeightTool: weighting all clusters of
+ *        an event at once must give the same cell weights as weighting
+ *        them one by one.
+ */
+
+#undef NDEBUG
+
+
+#include "CaloLCWeightToolTestAlg.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloClusterCellLink.h"
+#include "xAODCaloEvent/CaloClusterKineHelper.h"
+#include "AthenaKernel/errorcheck.h"
+#include "TestTools/random.h"
+#include "CLHEP/Units/SystemOfUnits.h"
+#include <iostream>
+#include <cassert>
+
+
+using CLHEP::GeV;
+
+
+/** 
+ * @brief Standard Gaudi initialize method.
+ */
+StatusCode CaloLCWeightToolTestAlg::initialize()
+{
+  CHECK( m_tool.retrieve() );
+  ATH_CHECK( m_caloMgrKey.initialize() );
+  return StatusCode::SUCCESS;
+}
+
+
+CaloCellContainer*
+CaloLCWeightToolTestAlg::make_cells (const CaloDetDescrManager& ddman)
+{
+  CaloCellContainer* cells = new CaloCellContainer;
+  for (CaloCell_ID::SUBCALO subcalo : { CaloCell_ID::LAREM,
+                                        CaloCell_ID::LARHEC,
+                                        CaloCell_ID::LARFCAL })
+  {
+    for (const CaloDetDescrElement* dde : ddman.element_range (subcalo)) {
+      float energy = Athena_test::randf_seed (m_seed, 10*GeV);
+      cells->push_back (new CaloCell (dde, energy, 0, 0, 0,
+                                      CaloGain::LARMEDIUMGAIN) );
+    }
+  }
+  cells->order();
+  cells->updateCaloIterators();
+  return cells;
+}
+
+
+std::vector<CaloLCWeightToolTestAlg::ClusterSpec>
+CaloLCWeightToolTestAlg::make_specs (const CaloDetDescrManager& ddman,
+                                     const CaloCellContainer& cells)
+{
+  std::vector<ClusterSpec> specs (50);
+  std::vector<IdentifierHash> hashes;
+  for (ClusterSpec& spec : specs) {
+    const double eta = Athena_test::randf_seed (m_seed, 9.) - 4.5;
+    const double phi = Athena_test::randf_seed (m_seed, 6.) - 3.;
+    hashes.clear();
+    ddman.cellsInZone (eta - 0.1, eta + 0.1, phi - 0.1, phi + 0.1, hashes);
+    for (IdentifierHash hash : hashes) {
+      int idx = cells.findIndex (hash);
+      if (idx < 0) continue;
+      // cells shared between clusters carry a weight < 1
+      const float weight = 0.5 + Athena_test::randf_seed (m_seed, 0.5);
+      spec.cells.emplace_back (idx, weight);
+    }
+    spec.emProbability = Athena_test::randf_seed (m_seed, 1.);
+  }
+  return specs;
+}
+
+
+std::unique_ptr<xAOD::CaloClusterContainer>
+CaloLCWeightToolTestAlg::make_clusters (const std::vector<ClusterSpec>& specs,
+                                        const CaloCellContainer* cells,
+                                        xAOD::CaloClusterAuxContainer& aux) const
+{
+  auto clusters = std::make_unique<xAOD::CaloClusterContainer>();
+  clusters->setStore (&aux);
+  for (const ClusterSpec& spec : specs) {
+    xAOD::CaloCluster* cl = new xAOD::CaloCluster;
+    clusters->push_back (cl);
+    cl->addCellLink (new CaloClusterCellLink (cells));
+    for (const std::pair<int, float>& c : spec.cells) {
+      cl->addCell (c.first, c.second);
+    }
+    CaloClusterKineHelper::calculateKine (cl, true, true);
+    cl->insertMoment (xAOD::CaloCluster::EM_PROBABILITY, spec.emProbability);
+  }
+  return clusters;
+}
+
+
+StatusCode CaloLCWeightToolTestAlg::test1()
+{
+  std::cout << "test1\n";
+
+  const EventContext& ctx = Gaudi::Hive::currentContext();
+
+  SG::ReadCondHandle<CaloDetDescrManager> caloMgrHandle{m_caloMgrKey, ctx};
+  assert (caloMgrHandle.isValid());
+  const CaloDetDescrManager* ddman = *caloMgrHandle;
+
+  const CaloCellContainer* cells = make_cells (*ddman);
+  CHECK( evtStore()->record (cells, "AllCalo") );
+  const std::vector<ClusterSpec> specs = make_specs (*ddman, *cells);
+
+  // One copy of the clusters is weighted cluster by cluster,
+  // the other one with a single call for all of them.
+  xAOD::CaloClusterAuxContainer aux1;
+  xAOD::CaloClusterAuxContainer aux2;
+  std::unique_ptr<xAOD::CaloClusterContainer> clusters1 =
+    make_clusters (specs, cells, aux1);
+  std::unique_ptr<xAOD::CaloClusterContainer> clusters2 =
+    make_clusters (specs, cells, aux2);
+
+  for (xAOD::CaloCluster* cl : *clusters1) {
+    CHECK( m_tool->weight (cl, ctx) );
+  }
+  std::vector<xAOD::CaloCluster*> clusterVec (clusters2->begin(),
+                                              clusters2->end());
+  CHECK( m_tool->weightClusters (clusterVec, ctx) );
+
+  size_t nchanged = 0;
+  for (size_t i = 0; i < specs.size(); i++) {
+    const xAOD::CaloCluster* cl1 = (*clusters1)[i];
+    const xAOD::CaloCluster* cl2 = (*clusters2)[i];
+    assert (cl1->size() == cl2->size());
+    if (cl1->e() != cl2->e()) {
+      std::cout << "Energy mismatch " << i << " "
+                << cl1->e() << " " << cl2->e() << "\n";
+    }
+    xAOD::CaloCluster::const_cell_iterator it1 = cl1->cell_begin();
+    xAOD::CaloCluster::const_cell_iterator it2 = cl2->cell_begin();
+    size_t icell = 0;
+    for (; it1 != cl1->cell_end(); ++it1, ++it2, ++icell) {
+      assert (it1.index() == it2.index());
+      if (it1.weight() != it2.weight()) {
+        std::cout << "Weight mismatch " << i << " " << it1.index() << " "
+                  << it1.weight() << " " << it2.weight() << "\n";
+      }
+      if (it1.weight() != specs[i].cells[icell].second) ++nchanged;
+    }
+  }
+
+  // Make sure the comparison is not trivial.
+  assert (nchanged > 0);
+
+  return StatusCode::SUCCESS;
+}
+
+
+/** 
+ * @brief Standard Gaudi execute method.
+ */
+StatusCode CaloLCWeightToolTestAlg::execute()
+{
+  CHECK( test1() );
+  return StatusCode::SUCCESS;
+}
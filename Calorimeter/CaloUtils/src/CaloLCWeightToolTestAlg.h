@@ -0,0 +1,80 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloLCWeightToolTestAlg.h
+ * @date Oct, 2022
+ * @brief Regression test for CaloLCWeightTool: weighting all clusters of
+ *        an event at once must give the same cell weights as weighting
+ *        them one by one.
+ */
+
+
+#ifndef CALOUTILS_CALOLCWEIGHTTOOLTESTALG_H
+#define CALOUTILS_CALOLCWEIGHTTOOLTESTALG_H
+
+
+#include "AthenaBaseComps/AthAlgorithm.h"
+#include "CaloInterface/IClusterCellWeightTool.h"
+#include "CaloDetDescr/CaloDetDescrManager.h"
+#include "StoreGate/ReadCondHandleKey.h"
+#include "xAODCaloEvent/CaloClusterContainer.h"
+#include "xAODCaloEvent/CaloClusterAuxContainer.h"
+#include "GaudiKernel/ToolHandle.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+class CaloCellContainer;
+
+
+class CaloLCWeightToolTestAlg
+  : public AthAlgorithm
+{
+public:
+  using AthAlgorithm::AthAlgorithm;
+
+
+  /** 
+   * @brief Standard Gaudi initialize method.
+   */
+  virtual StatusCode initialize() override;
+
+
+  /** 
+   * @brief Standard Gaudi execute method.
+   */
+  virtual StatusCode execute() override;
+
+
+private:
+  /// Cells and weights of one test cluster.
+  struct ClusterSpec
+  {
+    std::vector<std::pair<int, float> > cells;
+    double emProbability = 0;
+  };
+
+  CaloCellContainer* make_cells (const CaloDetDescrManager& ddman);
+  std::vector<ClusterSpec> make_specs (const CaloDetDescrManager& ddman,
+                                       const CaloCellContainer& cells);
+  std::unique_ptr<xAOD::CaloClusterContainer>
+  make_clusters (const std::vector<ClusterSpec>& specs,
+                 const CaloCellContainer* cells,
+                 xAOD::CaloClusterAuxContainer& aux) const;
+  StatusCode test1();
+
+  ToolHandle<IClusterCellWeightTool> m_tool
+  { this, "WeightTool", "CaloLCWeightTool/LCWeight", "Tool to test" };
+  SG::ReadCondHandleKey<CaloDetDescrManager> m_caloMgrKey { this
+      , "CaloDetDescrManager"
+      , "CaloDetDescrManager"
+      , "SG Key for CaloDetDescrManager in the Condition Store" };
+
+  uint32_t m_seed = 1;
+};
+
+
+
+
+#endif // not CALOUTILS_CALOLCWEIGHTTOOLTESTALG_H
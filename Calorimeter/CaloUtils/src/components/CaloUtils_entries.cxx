@@ -9,6 +9,8 @@
 #include "CaloUtils/xAODClusterCompressor.h"
 #include "../CaloTowerStoreTestAlg.h"
 #include "../CaloTowerBuilderToolTestAlg.h"
+#include "../CaloLCWeightToolTestAlg.h"
+#include "../CaloCellRoIIndexTestAlg.h"
 #include "CaloUtils/ToolWithConstantsTestTool.h"
 
 
@@ -24,5 +26,7 @@ DECLARE_COMPONENT( xAODClusterCompressor )
 
 DECLARE_COMPONENT( CaloTowerStoreTestAlg )
 DECLARE_COMPONENT( CaloTowerBuilderToolTestAlg )
+DECLARE_COMPONENT( CaloLCWeightToolTestAlg )
+DECLARE_COMPONENT( CaloCellRoIIndexTestAlg )
 DECLARE_COMPONENT( CaloUtils::ToolWithConstantsTestTool )
 
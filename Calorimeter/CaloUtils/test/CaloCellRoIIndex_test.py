@@ -0,0 +1,43 @@
+#!/usr/bin/env python
+#
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration.
+#
+# File: CaloUtils/test/CaloCellRoIIndex_test.py
+# Date: Oct, 2022
+# Brief: Test that CaloCellList selects the same cells with the
+#        CaloCellRoIIndex as with the CaloDetDescrManager lookup.
+#
+
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.ComponentFactory import CompFactory
+
+
+def testCfg (configFlags):
+    result = ComponentAccumulator()
+
+    from CaloDetDescr.CaloCellRoIIndexConfig import CaloCellRoIIndexCondAlgCfg
+    result.merge (CaloCellRoIIndexCondAlgCfg (configFlags))
+
+    result.addEventAlgo (CompFactory.CaloCellRoIIndexTestAlg ('CaloCellRoIIndexTestAlg'))
+    return result
+
+
+from AthenaConfiguration.AllConfigFlags import ConfigFlags
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+
+ConfigFlags.Input.Files = defaultTestFiles.RDO_RUN2
+ConfigFlags.Input.TimeStamp = 1000
+ConfigFlags.Detector.GeometryLAr = True
+ConfigFlags.Detector.GeometryTile = True
+ConfigFlags.needFlagsCategory('Tile')
+ConfigFlags.needFlagsCategory('LAr')
+
+ConfigFlags.lock()
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg 
+acc=MainServicesCfg (ConfigFlags)
+
+from McEventSelector.McEventSelectorConfig import McEventSelectorCfg
+acc.merge (McEventSelectorCfg (ConfigFlags))
+
+acc.merge (testCfg (ConfigFlags))
+acc.run(1)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python
+#
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration.
+#
+# File: CaloUtils/test/CaloLCWeightTool_test.py
+# Date: Oct, 2022
+# Brief: Test that CaloLCWeightTool gives the same cell weights when
+#        weighting all clusters at once as when weighting them one by one.
+#
+
+from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
+from AthenaConfiguration.ComponentFactory import CompFactory
+
+
+def testCfg (configFlags):
+    result = ComponentAccumulator()
+
+    from LArGeoAlgsNV.LArGMConfig import LArGMCfg
+    result.merge (LArGMCfg (configFlags))
+
+    from CaloTools.CaloNoiseCondAlgConfig import CaloNoiseCondAlgCfg
+    result.merge (CaloNoiseCondAlgCfg (configFlags, 'electronicNoise'))
+
+    from CaloRec.CaloTopoClusterConfig import caloTopoCoolFolderCfg
+    result.merge (caloTopoCoolFolderCfg (configFlags))
+
+    tool = CompFactory.CaloLCWeightTool ('LCWeight',
+                                         CorrectionKey = 'H1ClusterCellWeights',
+                                         SignalOverNoiseCut = 2.0,
+                                         UseHadProbability = True)
+    result.addEventAlgo (CompFactory.CaloLCWeightToolTestAlg ('CaloLCWeightToolTestAlg',
+                                                              WeightTool = tool))
+    return result
+
+
+from AthenaConfiguration.AllConfigFlags import ConfigFlags
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+
+ConfigFlags.Input.Files = defaultTestFiles.RDO_RUN2
+ConfigFlags.Input.TimeStamp = 1000
+ConfigFlags.Detector.GeometryLAr = True
+ConfigFlags.needFlagsCategory('LAr')
+
+ConfigFlags.lock()
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg 
+acc=MainServicesCfg (ConfigFlags)
+
+from McEventSelector.McEventSelectorConfig import McEventSelectorCfg
+acc.merge (McEventSelectorCfg (ConfigFlags))
+
+acc.merge (testCfg (ConfigFlags))
+acc.run(1)
@@ -32,6 +32,7 @@ class DebugView : public SimpleView, AthMessaging
 
     DebugView() = delete;
     DebugView( std::string const& Name, bool AllowFallThrough = true, std::string const& storeName = "StoreGateSvc" );
+    DebugView( std::string const& Name, bool AllowFallThrough, ServiceHandle< StoreGateSvc > const& store );
     virtual ~DebugView();
 
 
@@ -1,7 +1,7 @@
 ///////////////////////// -*- C++ -*- /////////////////////////////
 
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ATHVIEWS_SIMPLEVIEW_H
@@ -38,6 +38,12 @@ class SimpleView : public IProxyDict
 
     SimpleView() = delete;
     SimpleView( std::string const& Name, bool AllowFallThrough = true, std::string const& storeName = "StoreGateSvc" );
+
+    /**
+    * @brief Construct with the handle of an already retrieved event store
+    * Avoids the lookup of the store service for every new view
+    **/
+    SimpleView( std::string const& Name, bool AllowFallThrough, ServiceHandle< StoreGateSvc > const& store );
     virtual ~SimpleView();
 
    /**
@@ -1,7 +1,7 @@
 ///////////////////////// -*- C++ -*- /////////////////////////////
 
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ATHVIEWS_VIEW_H
@@ -26,6 +26,8 @@ class View : public IProxyDict {
 public:
   View () = delete;
   View (const std::string& name, const int index, const bool AllowFallThrough = true, std::string const& storeName = "StoreGateSvc");
+  /// Construct with the handle of an already retrieved event store, see SimpleView
+  View (const std::string& name, const int index, const bool AllowFallThrough, ServiceHandle<StoreGateSvc> const& store);
   virtual ~View ();
   View (const View&) = delete;
   View& operator= (const View&) = delete;
@@ -141,6 +143,9 @@ public:
 
 private:
 
+  /// Full name of the view, with the index appended if >= 0
+  static std::string fullName (const std::string& name, const int index);
+
 #ifdef ATHVIEWS_DEBUG
   DebugView *m_implementation;
 #else
@@ -171,6 +176,7 @@ public:
     std::for_each(m_data.begin(), m_data.end(), [](SG::View* v){ delete v; } ); 
   }
   void push_back( SG::View* ptr ) { m_data.push_back( ptr ); }
+  void reserve( size_t n ) { m_data.reserve( n ); }
   size_t size() const { return m_data.size(); }
   bool empty() const { return m_data.empty(); }
   void clear() {     
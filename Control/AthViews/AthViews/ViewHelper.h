@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ATHVIEWS_VIEWHELPER_HH
@@ -249,6 +249,22 @@ namespace ViewHelper
     return new SG::View( common_name, unique_index, allowFallThrough );
   }
 
+  /**
+   * As above, re-using the handle of an already retrieved event store (e.g. the evtStore() of the calling algorithm),
+   * which avoids the store service lookup for each view.
+   */
+  inline SG::View* makeView( const std::string& common_name, int const unique_index, bool const allowFallThrough,
+                             ServiceHandle<StoreGateSvc> const& store )
+  {
+    //Check for spaces in the name
+    if ( common_name.find( ' ' ) != std::string::npos )
+    {
+      return nullptr;
+    }
+
+    return new SG::View( common_name, unique_index, allowFallThrough, store );
+  }
+
 
   /**
    * navigate from the TrigComposite to nearest view and fetch object from it
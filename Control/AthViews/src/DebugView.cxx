@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthViews/DebugView.h"
@@ -12,6 +12,12 @@ DebugView::DebugView( std::string const& Name, bool AllowFallThrough, std::strin
 {
 }
 
+DebugView::DebugView( std::string const& Name, bool AllowFallThrough, ServiceHandle< StoreGateSvc > const& store ) :
+  SimpleView( Name, AllowFallThrough, store ),
+  AthMessaging( Name )
+{
+}
+
 DebugView::~DebugView()
 {
   // Debugging info
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include <stdexcept>
@@ -15,6 +15,14 @@ SimpleView::SimpleView( std::string const& Name, bool AllowFallThrough, std::str
 {
 }
 
+SimpleView::SimpleView( std::string const& Name, bool AllowFallThrough, ServiceHandle< StoreGateSvc > const& store ) :
+  m_store( store ),
+  m_roi(),
+  m_name( Name ),
+  m_allowFallThrough( AllowFallThrough )
+{
+}
+
 SimpleView::~SimpleView()
 {
 }
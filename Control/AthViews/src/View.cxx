@@ -1,27 +1,38 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "AthViews/View.h"
 
 using namespace SG;
 
-View::View(const std::string& name, const int index, const bool AllowFallThrough, std::string const& storeName) {
-
-  std::string fullName = name;
+std::string View::fullName(const std::string& name, const int index) {
   if ( index == -1 ) {
-    m_index = 0;
-  }
-  else {
-    m_index = index;
-    fullName += '_';
-    fullName += std::to_string( index );
+    return name;
   }
+  std::string fullName = name;
+  fullName += '_';
+  fullName += std::to_string( index );
+  return fullName;
+}
+
+View::View(const std::string& name, const int index, const bool AllowFallThrough, std::string const& storeName) :
+  m_index( index == -1 ? 0 : index )
+{
+#ifdef ATHVIEWS_DEBUG
+  m_implementation = new DebugView( fullName( name, index ), AllowFallThrough, storeName );
+#else
+  m_implementation = new SimpleView( fullName( name, index ), AllowFallThrough, storeName );
+#endif
+}
 
+View::View(const std::string& name, const int index, const bool AllowFallThrough, ServiceHandle<StoreGateSvc> const& store) :
+  m_index( index == -1 ? 0 : index )
+{
 #ifdef ATHVIEWS_DEBUG
-  m_implementation = new DebugView( fullName, AllowFallThrough, storeName );
+  m_implementation = new DebugView( fullName( name, index ), AllowFallThrough, store );
 #else
-  m_implementation = new SimpleView( fullName, AllowFallThrough, storeName );
+  m_implementation = new SimpleView( fullName( name, index ), AllowFallThrough, store );
 #endif
 }
 
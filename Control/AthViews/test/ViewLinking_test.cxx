@@ -130,6 +130,21 @@ void testFallThrough( StoreGateSvc* sg , MsgStream& log) {
     rh.setProxyDict( transparentView ).ignore();
     VALUE( rh.isValid() ) EXPECTED( true );
   }
+  {
+    // Same with views sharing an already retrieved store handle
+    ServiceHandle<StoreGateSvc> store( "StoreGateSvc", "ViewLinking_test" );
+    VALUE( store.retrieve().isSuccess() ) EXPECTED( true );
+    auto opaqueView = ViewHelper::makeView( "OpaqueView", 1, false, store );
+    auto transparentView = ViewHelper::makeView( "TransparentView", 1, true, store );
+    VALUE( opaqueView->name() == "OpaqueView_1" ) EXPECTED( true );
+    VALUE( opaqueView->viewID() ) EXPECTED( 1u );
+    SG::ReadHandle<TestClass> rh( "inStore" );
+    rh.setProxyDict( opaqueView ).ignore();
+    VALUE( rh.isValid() ) EXPECTED( false );
+    SG::ReadHandle<TestClass> rh2( "inStore" );
+    rh2.setProxyDict( transparentView ).ignore();
+    VALUE( rh2.isValid() ) EXPECTED( true );
+  }
   log << MSG::INFO << "Fall through works as expected" << endmsg;
 }
 
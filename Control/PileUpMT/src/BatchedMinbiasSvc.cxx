@@ -8,10 +8,14 @@
 #include <chrono>
 #include <thread>
 
+#include <unistd.h>
+
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <boost/core/demangle.hpp>
 
+#include "CxxUtils/read_athena_statm.h"
+
 #include "AthenaKernel/IAddressProvider.h"
 #include "AthenaKernel/IProxyProviderSvc.h"
 #include "SGTools/CurrentEventStore.h"
@@ -117,8 +121,155 @@ StatusCode BatchedMinbiasSvc::initialize() {
     return StatusCode::SUCCESS;
 }
 
+StatusCode BatchedMinbiasSvc::finalize() {
+    {
+        // the remaining HS events may not need the prefetched batch, stop waiting for a cache
+        m_stop_prefetch = true;
+        std::lock_guard lg{m_prefetch_mtx};
+        if (m_prefetch.valid()) {
+            ATH_CHECK(m_prefetch.get());
+        }
+    }
+    ATH_MSG_INFO(fmt::format("Read {} batches ({} prefetched) in {:.1f} s, HS events waited {:.1f} s "
+                             "for their batch",
+                             m_nbatches_loaded.load(), m_nbatches_prefetched.load(),
+                             m_load_time_us.load() * 1e-6, m_stall_time_us.load() * 1e-6));
+    return StatusCode::SUCCESS;
+}
+
+StatusCode BatchedMinbiasSvc::loadBatch(int batch) {
+    std::scoped_lock reading{m_cache_mtxs[batch], m_reading_batch_mtx};
+    if (m_HSBatchSize != 1) {
+        if (Gaudi::Hive::currentContext().valid()) {
+            ATH_MSG_INFO("Reading batch " << batch << " in event "
+                         << Gaudi::Hive::currentContext().evt() << ", slot "
+                         << Gaudi::Hive::currentContext().slot());
+        }
+        else {
+            ATH_MSG_INFO("Reading batch " << batch << " in the background");
+        }
+    }
+    auto start_time = std::chrono::steady_clock::now();
+    // resident memory before reading, other threads may allocate too
+    const athena_statm start_mem = read_athena_statm();
+    m_cache[batch] = std::move(m_empty_caches.front());
+    m_cache_used[batch].reserve(m_MBBatchSize.value());
+    for (int i = 0; i < m_MBBatchSize.value(); ++i) {
+        m_cache_used[batch].emplace_back(std::make_unique<std::atomic_bool>(false));
+    }
+    m_empty_caches.pop_front();
+    // Remember old store to reset later
+    auto* old_store = m_activeStoreSvc->activeStore();
+    for (auto&& sg : *m_cache[batch]) {
+        if (sg->proxies().size() != 0) {
+            // Not cleared therefore not used -- don't reload
+            continue;
+        }
+        // Change active store
+        m_activeStoreSvc->setStore(sg.get());
+        SG::CurrentEventStore::Push reader_sg_ces(sg.get());
+        // Read next event
+        ATH_CHECK(sg->clearStore(true));
+        if (!(m_bkgEventSelector->next(*m_bkg_evt_sel_ctx)).isSuccess()) {
+            ATH_MSG_FATAL("Ran out of minbias events");
+            return StatusCode::FAILURE;
+        }
+        IOpaqueAddress* addr = nullptr;
+        if (!m_bkgEventSelector->createAddress(*m_bkg_evt_sel_ctx, addr).isSuccess()) {
+            ATH_MSG_WARNING("Failed to create address. No more events?");
+            return StatusCode::FAILURE;
+        }
+        if (addr == nullptr) {
+            ATH_MSG_WARNING("createAddress returned nullptr. No more events?");
+            return StatusCode::FAILURE;
+        }
+        ATH_CHECK(sg->recordAddress(addr));
+        ATH_CHECK(sg->loadEventProxies());
+        // Read data now if desired
+        for (auto* proxy_ptr : sg->proxies()) {
+            if (!proxy_ptr->isValid()) {
+                // Get this warning on every event
+                // ATH_MSG_WARNING("Invalid proxy");
+                continue;
+            }
+
+            if (!m_onDemandMB) {
+                // Sort of a const_cast, then ->accessData()
+                sg->proxy_exact(proxy_ptr->sgkey())->accessData();
+            }
+        }
+    }
+    // Reset active store
+    m_activeStoreSvc->setStore(old_store);
+    const auto load_time = std::chrono::steady_clock::now() - start_time;
+    m_load_time_us += std::chrono::duration_cast<std::chrono::microseconds>(load_time).count();
+    ++m_nbatches_loaded;
+    if (m_HSBatchSize != 1) {
+        const athena_statm end_mem = read_athena_statm();
+        const long rss_kb = (static_cast<long>(end_mem.rss_pages) - static_cast<long>(start_mem.rss_pages)) *
+                            (sysconf(_SC_PAGESIZE) / 1024);
+        ATH_MSG_INFO(fmt::format("Reading {} events took {:%OMm %OSs}, RSS grew by {} MB",
+                                 m_cache[batch]->size(), load_time, rss_kb / 1024));
+    }
+    m_last_loaded_batch.exchange(batch);
+    return StatusCode::SUCCESS;
+}
+
+StatusCode BatchedMinbiasSvc::startPrefetch(int batch) {
+    const int next = batch + 1;
+    if (next >= static_cast<int>(m_actualNHSEventsPerBatch.value().size())) {
+        return StatusCode::SUCCESS;
+    }
+    std::unique_lock lock{m_prefetch_mtx, std::try_to_lock};
+    if (!lock.owns_lock()) {
+        // another HS event is starting the prefetch
+        return StatusCode::SUCCESS;
+    }
+    if (m_prefetch.valid()) {
+        if (m_prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return StatusCode::SUCCESS;
+        }
+        // report a failed background read to the HS event rather than losing it
+        ATH_CHECK(m_prefetch.get());
+    }
+    if (m_last_prefetched_batch >= next) {
+        return StatusCode::SUCCESS;
+    }
+    m_last_prefetched_batch = next;
+    m_prefetch = std::async(std::launch::async, [this, next]() { return prefetchBatch(next); });
+    return StatusCode::SUCCESS;
+}
+
+StatusCode BatchedMinbiasSvc::prefetchBatch(int batch) {
+    using namespace std::chrono_literals;
+    while (!m_stop_prefetch) {
+        // Same protocol as beginHardScatter: whoever gets the lock first with a free cache reads
+        std::unique_lock lock{m_empty_caches_mtx, std::try_to_lock};
+        if (lock.owns_lock() && m_cache.count(batch)) {
+            // the first HS event of the batch was faster
+            return StatusCode::SUCCESS;
+        }
+        if (lock.owns_lock() && !m_empty_caches.empty()) {
+            ATH_CHECK(loadBatch(batch));
+            ++m_nbatches_prefetched;
+            return StatusCode::SUCCESS;
+        }
+        if (lock.owns_lock()) {
+            lock.unlock();
+        }
+        std::this_thread::sleep_for(100ms);
+    }
+    return StatusCode::SUCCESS;
+}
+
 StatusCode BatchedMinbiasSvc::beginHardScatter(std::uint64_t hs_id) {
     using namespace std::chrono_literals;
+    const auto start_time = std::chrono::steady_clock::now();
+    auto add_stall_time = [this, &start_time]() {
+        m_stall_time_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - start_time)
+                                 .count();
+    };
     int batch = event_to_batch(hs_id);
     while (true) {
         if (m_cache.count(batch)) {
@@ -126,6 +277,12 @@ StatusCode BatchedMinbiasSvc::beginHardScatter(std::uint64_t hs_id) {
             // mutex prevents returning when batch is partially loaded
             m_cache_mtxs[batch].lock();
             m_cache_mtxs[batch].unlock();
+            add_stall_time();
+            // Read the next batch while the remaining HS events of this one are processed.
+            // Only the most recently loaded batch triggers a prefetch, to keep them in order.
+            if (m_prefetchNextBatch && m_last_loaded_batch == batch) {
+                ATH_CHECK(startPrefetch(batch));
+            }
             return StatusCode::SUCCESS;
         }
         // prevent batches loading out-of-order
@@ -134,77 +291,15 @@ StatusCode BatchedMinbiasSvc::beginHardScatter(std::uint64_t hs_id) {
         }
         // See if there are any free caches
         // Using try_lock here to avoid reading same batch twice
-        if (m_empty_caches_mtx.try_lock()) {
-            if (!m_empty_caches.empty()) {
-                std::scoped_lock reading{m_cache_mtxs[batch], m_reading_batch_mtx};
-                if (m_HSBatchSize != 1) {
-                    ATH_MSG_INFO("Reading next batch in event "
-                                 << Gaudi::Hive::currentContext().evt() << ", slot "
-                                 << Gaudi::Hive::currentContext().slot());
-                }
-                auto start_time = std::chrono::system_clock::now();
-                m_cache[batch] = std::move(m_empty_caches.front());
-                m_cache_used[batch].reserve(m_MBBatchSize.value());
-                for (int i = 0; i < m_MBBatchSize.value(); ++i) {
-                    m_cache_used[batch].emplace_back(std::make_unique<std::atomic_bool>(false));
-                }
-                m_empty_caches.pop_front();
-                // Remember old store to reset later
-                auto* old_store = m_activeStoreSvc->activeStore();
-                for (auto&& sg : *m_cache[batch]) {
-                    if (sg->proxies().size() != 0) {
-                        // Not cleared therefore not used -- don't reload
-                        continue;
-                    }
-                    // Change active store
-                    m_activeStoreSvc->setStore(sg.get());
-                    SG::CurrentEventStore::Push reader_sg_ces(sg.get());
-                    // Read next event
-                    ATH_CHECK(sg->clearStore(true));
-                    if (!(m_bkgEventSelector->next(*m_bkg_evt_sel_ctx)).isSuccess()) {
-                        ATH_MSG_FATAL("Ran out of minbias events");
-                        return StatusCode::FAILURE;
-                    }
-                    IOpaqueAddress* addr = nullptr;
-                    if (!m_bkgEventSelector->createAddress(*m_bkg_evt_sel_ctx, addr).isSuccess()) {
-                        ATH_MSG_WARNING("Failed to create address. No more events?");
-                        return StatusCode::FAILURE;
-                    }
-                    if (addr == nullptr) {
-                        ATH_MSG_WARNING("createAddress returned nullptr. No more events?");
-                        return StatusCode::FAILURE;
-                    }
-                    ATH_CHECK(sg->recordAddress(addr));
-                    ATH_CHECK(sg->loadEventProxies());
-                    // Read data now if desired
-                    for (auto* proxy_ptr : sg->proxies()) {
-                        if (!proxy_ptr->isValid()) {
-                            // Get this warning on every event
-                            // ATH_MSG_WARNING("Invalid proxy");
-                            continue;
-                        }
-
-                        if (!m_onDemandMB) {
-                            // Sort of a const_cast, then ->accessData()
-                            sg->proxy_exact(proxy_ptr->sgkey())->accessData();
-                        }
-                    }
-                }
-                // Reset active store
-                m_activeStoreSvc->setStore(old_store);
-                if (m_HSBatchSize != 1) {
-                    ATH_MSG_INFO(fmt::format("Reading {} events took {:%OMm %OSs}",
-                                             m_cache[batch]->size(),
-                                             std::chrono::system_clock::now() - start_time));
-                }
-                m_empty_caches_mtx.unlock();
-                m_last_loaded_batch.exchange(batch);
-                return StatusCode::SUCCESS;
-            }
-            else {
-                // Unlock mutex if we got the lock but all caches were empty
-                m_empty_caches_mtx.unlock();
-            }
+        std::unique_lock lock{m_empty_caches_mtx, std::try_to_lock};
+        if (lock.owns_lock() && !m_empty_caches.empty() && !m_cache.count(batch)) {
+            ATH_CHECK(loadBatch(batch));
+            add_stall_time();
+            return StatusCode::SUCCESS;
+        }
+        if (lock.owns_lock()) {
+            // Unlock mutex if we got the lock but all caches were empty
+            lock.unlock();
         }
         // Wait  100ms then try again
         std::this_thread::sleep_for(100ms);
@@ -222,6 +317,8 @@ StatusCode BatchedMinbiasSvc::endHardScatter(std::uint64_t hs_id) {
     using namespace std::chrono_literals;
     int batch = event_to_batch(hs_id);
     int uses = m_batch_use_count[batch]->fetch_add(1) + 1;
+    ATH_MSG_DEBUG("Batch " << batch << " still needed by "
+                  << m_actualNHSEventsPerBatch.value().at(batch) - uses << " HS events");
 
     // If we're done with every event in the batch, clear the stores and return them
     if (uses == m_actualNHSEventsPerBatch.value().at(batch)) {
@@ -231,7 +328,7 @@ StatusCode BatchedMinbiasSvc::endHardScatter(std::uint64_t hs_id) {
         m_cache_used.erase(batch);
         std::size_t i = 0;
         for (auto&& sg : *temp) {
-            if (used.at(i)) {
+            if (*used.at(i++)) {
                 ATH_CHECK(sg->clearStore(true));
             }
         }
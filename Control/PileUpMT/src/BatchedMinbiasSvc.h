@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <deque>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -31,6 +32,8 @@ class BatchedMinbiasSvc : public extends<AthService, IMinbiasSvc> {
 
     /// AthService initialize
     StatusCode initialize() override final;
+    /// AthService finalize
+    StatusCode finalize() override final;
 
     StatusCode beginHardScatter(std::uint64_t hs_id) override;
     StoreGateSvc* getMinbias(std::uint64_t hs_id, std::uint64_t mb_id) override;
@@ -48,6 +51,10 @@ class BatchedMinbiasSvc : public extends<AthService, IMinbiasSvc> {
                                                   "Max number of batches to load simultaneously"};
     Gaudi::Property<int> m_HSBatchSize{
           this, "HSBatchSize", 1, "Number of HS events per batch (aka max reuse factor)"};
+    Gaudi::Property<bool> m_prefetchNextBatch{
+          this, "PrefetchNextBatch", true,
+          "Read the next batch in a background task as soon as a free cache is available, instead "
+          "of when its first HS event starts (needs NSimultaneousBatches > 1)"};
     Gaudi::Property<std::vector<int>> m_actualNHSEventsPerBatch{
           this,
           "actualNHSEventsPerBatch",
@@ -71,7 +78,24 @@ class BatchedMinbiasSvc : public extends<AthService, IMinbiasSvc> {
     std::vector<std::unique_ptr<std::atomic_int>> m_batch_use_count;
     std::atomic_int m_last_loaded_batch;
     std::atomic_int m_last_unloaded_batch;
+    // statistics reported in finalize
+    std::atomic_int m_nbatches_loaded{0};
+    std::atomic_int m_nbatches_prefetched{0};
+    std::atomic<std::int64_t> m_load_time_us{0};  // time spent reading batches
+    std::atomic<std::int64_t> m_stall_time_us{0}; // time HS events waited for their batch
+    // background read of the next batch
+    std::future<StatusCode> m_prefetch;
+    std::mutex m_prefetch_mtx; // protects m_prefetch
+    std::atomic_int m_last_prefetched_batch{-1};
+    std::atomic_bool m_stop_prefetch{false};
     int event_to_batch(std::uint64_t hs_id);
+    /// Read the events of a batch into the first empty cache.
+    /// Must be called with m_empty_caches_mtx held and m_empty_caches not empty.
+    StatusCode loadBatch(int batch);
+    /// Start reading the batch after @c batch in a background task, if none is running.
+    StatusCode startPrefetch(int batch);
+    /// Body of the background task: wait for a free cache, then read @c batch into it.
+    StatusCode prefetchBatch(int batch);
 };
 
 #endif // TESTCODE_LOWPTMINBIASSVC
@@ -4,7 +4,8 @@
  #include "PixelDigitizationUtilities.h"
  #include "BichselData.h"
  #include <cmath> //for pow
- #include <algorithm> //for std::clamp
+ #include <algorithm> //for std::clamp, std::upper_bound, std::fill
+ #include <limits>
  
 
  
@@ -40,6 +41,35 @@ BichselData::addEntry(double logBetaGamma, double logCollisionEnergy, double log
 
 void BichselData::updateAfterLastEntry(){
   logHighestCrossSectionsVector.push_back(logIntegratedCrossSectionsVectorOfVector.back().back());
+  buildSamplingTables();
+}
+
+//=======================================
+// S A M P L I N G   T A B L E S
+//=======================================
+void
+BichselData::buildSamplingTables(){
+  flatLogIntegratedCrossSections.clear();
+  segmentIntercepts.clear();
+  segmentSlopes.clear();
+  rowOffsets.assign(1, 0);
+  for (size_t iRow = 0; iRow < size(); ++iRow) {
+    const std::vector<double> & logIntX = logIntegratedCrossSectionsVectorOfVector[iRow];
+    const std::vector<double> & logColE = logCollisionEnergyVectorOfVector[iRow];
+    for (size_t i = 0; i < logIntX.size(); ++i) {
+      flatLogIntegratedCrossSections.push_back(logIntX[i]);
+      double intercept = std::numeric_limits<double>::quiet_NaN();
+      double slope = 0.;
+      // same protection against equal values as in interpolateCollisionEnergy; the last node has no segment
+      if ((i + 1 < logIntX.size()) and (logIntX[i + 1] - logIntX[i] >= 1e-300)) {
+        slope = (logColE[i + 1] - logColE[i]) / (logIntX[i + 1] - logIntX[i]);
+        intercept = logColE[i] - slope * logIntX[i];
+      }
+      segmentIntercepts.push_back(intercept);
+      segmentSlopes.push_back(slope);
+    }
+    rowOffsets.push_back(flatLogIntegratedCrossSections.size());
+  }
 }
  
  
@@ -100,6 +130,41 @@ BichselData::interpolateCollisionEnergy(std::pair<int, int> indices_BetaGammaLog
   return std::pow(10., Est);
 }
 
+//==============================================
+// B A T C H E D   C O L L I S I O N   E N E R G Y
+//==============================================
+void
+BichselData::interpolateCollisionEnergies(int indexBetaGammaLog10, double* values, size_t n) const {
+  if ((indexBetaGammaLog10 < 0) or (static_cast<size_t>(indexBetaGammaLog10) + 1 >= rowOffsets.size())) {
+    std::fill(values, values + n, -1.);
+    return;
+  }
+  const double* first = flatLogIntegratedCrossSections.data() + rowOffsets[indexBetaGammaLog10];
+  const double* last = flatLogIntegratedCrossSections.data() + rowOffsets[indexBetaGammaLog10 + 1];
+  const double* intercepts = segmentIntercepts.data() + rowOffsets[indexBetaGammaLog10];
+  const double* slopes = segmentSlopes.data() + rowOffsets[indexBetaGammaLog10];
+  if (first == last) {
+    std::fill(values, values + n, -1.);
+    return;
+  }
+  // separate passes, such that the logarithm and the power can be vectorised by the compiler
+  for (size_t i = 0; i < n; ++i) {
+    values[i] = std::log10(values[i]);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    const double logIntX = values[i];
+    if ((logIntX < *first) or (logIntX >= *(last - 1)) or std::isnan(logIntX)) {
+      values[i] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    const size_t iSegment = std::upper_bound(first, last, logIntX) - first - 1;
+    values[i] = intercepts[iSegment] + slopes[iSegment] * logIntX;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    values[i] = std::isnan(values[i]) ? -1. : std::pow(10., std::clamp(values[i], -300., 300.));
+  }
+}
+
 //===========================================
 // Overloaded C O L L I S I O N  E N E R G Y
 //===========================================
@@ -17,6 +17,13 @@ struct BichselData {
   std::vector<std::vector<double> > logCollisionEnergyVectorOfVector;  // ColE = CollisionEnergy in eV
   std::vector<std::vector<double> > logIntegratedCrossSectionsVectorOfVector;  // IntX = Integrated Xsection. The unit doesn't matter
   std::vector<double> logHighestCrossSectionsVector;      // upper bound of log10(IntX)
+  // Inverse cumulative cross section tables for batched sampling, filled by updateAfterLastEntry().
+  // The nodes of all beta-gamma rows are stored contiguously, row i starting at rowOffsets[i];
+  // segment k of a row is log10(ColE) = segmentIntercepts[j] + segmentSlopes[j] * log10(IntX), with j = rowOffsets[i]+k
+  std::vector<double> flatLogIntegratedCrossSections;
+  std::vector<double> segmentIntercepts;
+  std::vector<double> segmentSlopes;
+  std::vector<size_t> rowOffsets;
   //methods
   //
   bool empty() const{ return logBetaGammaVector.empty();}
@@ -24,13 +31,17 @@ struct BichselData {
   double lastBetaGammaValue() const;
   void addNewLogBetaGamma(double logBetaGamma);
   void addEntry(double logBetaGamma, double logCollisionEnergy, double logIntegratedCrossSection);
-  void updateAfterLastEntry();
+  void updateAfterLastEntry();  // to be called once after the last addEntry()
+  void buildSamplingTables();
   //
   std::pair<int, int> getBetaGammaIndices(double BetaGammaLog10) const ; // get beta-gamma index. This is so commonly used by other functions that a caching would be beneficial
   double interpolateCollisionEnergy(std::pair<int, int> indices_BetaGammaLog10, double IntXLog10) const;
   double interpolateCollisionEnergy(double BetaGammaLog10, double IntXLog10) const;       // return ColE NOT ColELog10
   double interpolateCrossSection(std::pair<int, int> indices_BetaGammaLog10, double BetaGammaLog10) const;// return IntX upper bound
   double interpolateCrossSection(double BetaGammaLog10) const;                   // return IntX upper bound
+  // Batched version of interpolateCollisionEnergy for one beta-gamma row: converts the n values of IntX
+  // (NOT IntXLog10) in place to ColE, or to -1 where the table does not cover IntX. Needs the sampling tables.
+  void interpolateCollisionEnergies(int indexBetaGammaLog10, double* values, size_t n) const;
 
 };
 #endif
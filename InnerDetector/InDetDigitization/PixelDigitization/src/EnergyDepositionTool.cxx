@@ -28,6 +28,7 @@
 #include "TLorentzVector.h"
 #include "CLHEP/Units/PhysicalConstants.h"
 #include "PixelDigitizationUtilities.h"
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <limits> //for numeric_limits min
@@ -332,7 +333,7 @@ EnergyDepositionTool::BichselSim(double BetaGamma, int ParticleType,double Total
   }
 
   // load relevant data
-  BichselData iData = m_bichselData[ParticleType - 1];
+  const BichselData& iData = m_bichselData[ParticleType - 1];
   double BetaGammaLog10 = std::log10(BetaGamma);
   std::pair<int, int> indices_BetaGammaLog10 = iData.getBetaGammaIndices(BetaGammaLog10);
  
@@ -361,65 +362,89 @@ EnergyDepositionTool::BichselSim(double BetaGamma, int ParticleType,double Total
   }
 
   // begin simulation
+  // Random numbers are drawn in batches sized for the expected number of collisions along the path,
+  // and the collision energies of a batch are interpolated in one pass over the tables
+  const int maxCount = static_cast<int>(std::ceil(1.0 * LoopLimit / m_nCols));
+  const double expectedCount = TotalLength / (lambda * m_nCols);
+  const int batchSize = std::clamp(static_cast<int>(expectedCount + 3. * std::sqrt(expectedCount)) + 1,
+                                   1, std::min(maxCount, s_maxBatchSize));
+  std::vector<double> hitPositions(batchSize * m_nCols);
+  std::vector<double> collisionEnergies(batchSize);
+  rawHitRecord.reserve(static_cast<size_t>(expectedCount) + 1);
+
   int count = 0;
-  while (true) {
-    // infinite loop protection
-    if (count >= (1.0 * LoopLimit / m_nCols)) {
-      ATH_MSG_WARNING(
-        "Potential infinite loop in BichselSim. Exit Loop. A special flag will be returned (-1,-1). The total length is " << TotalLength << ". The lambda is " << lambda <<
-          ".");
-      SetFailureFlag(rawHitRecord);
-      break;
-    }
+  bool finished = false;
+  while (not finished) {
+    CLHEP::RandExpZiggurat::shootArray(rndmEngine, batchSize * m_nCols, hitPositions.data(), lambda);
+    CLHEP::RandFlat::shootArray(rndmEngine, batchSize, collisionEnergies.data(), 0., IntXUpperBound);
+    iData.interpolateCollisionEnergies(indices_BetaGammaLog10.second, collisionEnergies.data(), batchSize);
+
+    for (int iBatch = 0; iBatch < batchSize; iBatch++) {
+      // infinite loop protection
+      if (count >= maxCount) {
+        ATH_MSG_WARNING(
+          "Potential infinite loop in BichselSim. Exit Loop. A special flag will be returned (-1,-1). The total length is " << TotalLength << ". The lambda is " << lambda <<
+            ".");
+        SetFailureFlag(rawHitRecord);
+        finished = true;
+        break;
+      }
 
-    // sample hit position -- exponential distribution
-    double HitPosition = 0.;
-    for (int iHit = 0; iHit < m_nCols; iHit++) {
-      HitPosition += CLHEP::RandExpZiggurat::shoot(rndmEngine, lambda);
-    }
-    // termination by hit position
-    // yes, in case m_nCols > 1, we will loose the last m_nCols collisions. So m_nCols cannot be too big
-    if (accumLength + HitPosition >= TotalLength) break;
-
-    // sample single collision
-    double TossEnergyLoss = -1.;
-    while (TossEnergyLoss <= 0.) { // we have to do this because sometimes TossEnergyLoss will be negative due to too
-                                   // small TossIntX
-      double TossIntX = CLHEP::RandFlat::shoot(rndmEngine, 0., IntXUpperBound);
-      TossEnergyLoss = iData.interpolateCollisionEnergy(indices_BetaGammaLog10, std::log10(TossIntX));
-    }
+      // sample hit position -- exponential distribution
+      double HitPosition = 0.;
+      for (int iHit = 0; iHit < m_nCols; iHit++) {
+        HitPosition += hitPositions[iBatch * m_nCols + iHit];
+      }
+      // termination by hit position
+      // yes, in case m_nCols > 1, we will loose the last m_nCols collisions. So m_nCols cannot be too big
+      if (accumLength + HitPosition >= TotalLength) {
+        finished = true;
+        break;
+      }
 
-    // check if it is delta-ray -- delta-ray is already taken care of by G4 and treated as an independent hit.
-    // Unfortunately, we won't deal with delta-ray using Bichsel's model
-    // as long as m_nCols is not very big, the probability of having >= 2 such a big energy loss in a row is very small.
-    // In case there is a delta-ray, it would be so dominant that other energy deposition becomes negligible
-    if (TossEnergyLoss > (m_DeltaRayCut * 1000.)) {
-      TossEnergyLoss = 0.;
-    }
+      // sample single collision
+      double TossEnergyLoss = collisionEnergies[iBatch];
+      while (TossEnergyLoss <= 0.) { // we have to do this because sometimes TossEnergyLoss will be negative due to too
+                                     // small TossIntX
+        double TossIntX = CLHEP::RandFlat::shoot(rndmEngine, 0., IntXUpperBound);
+        TossEnergyLoss = iData.interpolateCollisionEnergy(indices_BetaGammaLog10, std::log10(TossIntX));
+      }
 
-    bool fLastStep = false;
+      // check if it is delta-ray -- delta-ray is already taken care of by G4 and treated as an independent hit.
+      // Unfortunately, we won't deal with delta-ray using Bichsel's model
+      // as long as m_nCols is not very big, the probability of having >= 2 such a big energy loss in a row is very small.
+      // In case there is a delta-ray, it would be so dominant that other energy deposition becomes negligible
+      if (TossEnergyLoss > (m_DeltaRayCut * 1000.)) {
+        TossEnergyLoss = 0.;
+      }
 
-    if (((TotalEnergyLoss + TossEnergyLoss) / 1.E+6) > InciEnergy) {
-      ATH_MSG_WARNING(
-        "Energy loss is larger than incident energy in EnergyDepositionTool::BichselSim! This is usually delta-ray.");
-      TossEnergyLoss = InciEnergy * 1.E+6 - TotalEnergyLoss;
-      fLastStep = true;
-    }
+      bool fLastStep = false;
 
-    // update
-    accumLength += HitPosition;
-    TotalEnergyLoss += TossEnergyLoss;
+      if (((TotalEnergyLoss + TossEnergyLoss) / 1.E+6) > InciEnergy) {
+        ATH_MSG_WARNING(
+          "Energy loss is larger than incident energy in EnergyDepositionTool::BichselSim! This is usually delta-ray.");
+        TossEnergyLoss = InciEnergy * 1.E+6 - TotalEnergyLoss;
+        fLastStep = true;
+      }
 
-    // record this hit
-    std::pair<double, double> oneHit;
-    if (m_nCols == 1) oneHit.first = accumLength;
-    else oneHit.first = (accumLength - 1.0 * HitPosition / 2);// as long as m_nCols is small enough (making sure lambda*m_nCols is within resolution of a pixel), then taking middle point might still be reasonable
-    oneHit.second = TossEnergyLoss;
-    rawHitRecord.push_back(oneHit);
+      // update
+      accumLength += HitPosition;
+      TotalEnergyLoss += TossEnergyLoss;
+
+      // record this hit
+      std::pair<double, double> oneHit;
+      if (m_nCols == 1) oneHit.first = accumLength;
+      else oneHit.first = (accumLength - 1.0 * HitPosition / 2);// as long as m_nCols is small enough (making sure lambda*m_nCols is within resolution of a pixel), then taking middle point might still be reasonable
+      oneHit.second = TossEnergyLoss;
+      rawHitRecord.push_back(oneHit);
 
-    count++;
+      count++;
 
-    if (fLastStep) break;
+      if (fLastStep) {
+        finished = true;
+        break;
+      }
+    }
   }
 
   ATH_MSG_DEBUG("Finish EnergyDepositionTool::BichselSim");
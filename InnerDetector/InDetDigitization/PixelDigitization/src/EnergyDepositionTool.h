@@ -71,6 +71,7 @@ private:
   };
 
    std::vector<BichselData> m_bichselData;      // vector to store Bichsel Data. Each entry is for one particle type
+   static constexpr int s_maxBatchSize = 4096;  // maximum number of collisions sampled at once in BichselSim
 
   Gaudi::Property<int> m_numberOfSteps
   {
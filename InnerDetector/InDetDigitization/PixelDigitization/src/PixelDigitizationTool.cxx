@@ -6,9 +6,18 @@
 #include "SiDigitization/SiChargedDiodeCollection.h"
 #include "AthenaKernel/RNGWrapper.h"
 #include "CLHEP/Random/RandomEngine.h"
+#include "CLHEP/Random/MixMaxRng.h"
+#include "CxxUtils/crc64.h"
+#include "GaudiKernel/ThreadLocalContext.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
 #include <limits>
 #include <cstdint>
+#include <memory>
 
 PixelDigitizationTool::PixelDigitizationTool(const std::string& type,
                                              const std::string& name,
@@ -125,17 +134,12 @@ StatusCode PixelDigitizationTool::digitizeEvent(const EventContext& ctx) {
   }
 
   std::unique_ptr<SiChargedDiodeCollection> chargedDiodes = std::make_unique<SiChargedDiodeCollection>();
-  std::vector<std::pair<double, double> > trfHitRecord;
-  trfHitRecord.clear();
-  std::vector<double> initialConditions;
-  initialConditions.clear();
-
   std::vector<bool> processedElements;
   processedElements.resize(m_detID->wafer_hash_max(), false);
 
   // Set the RNG to use for this event.
   ATHRNG::RNGWrapper* rngWrapper = m_rndmSvc->getEngine(this);
-  rngWrapper->setSeed(name(), ctx);
+  rngWrapper->setSeed(randomStreamName(), ctx);
   CLHEP::HepRandomEngine* rndmEngine = rngWrapper->getEngine(ctx);
 
   TimedHitCollection<SiHit>::const_iterator firstHit, lastHit;
@@ -143,6 +147,7 @@ StatusCode PixelDigitizationTool::digitizeEvent(const EventContext& ctx) {
   ////////////////////////////////////////////////
   // **** Loop over the Detectors with hits ****
   ////////////////////////////////////////////////
+  std::vector<ModuleHits> modules;
   while (m_timedHits->nextDetectorElement(firstHit, lastHit)) {
     // Create the identifier for the collection
     ATH_MSG_DEBUG("create ID for the hit collection");
@@ -162,67 +167,37 @@ StatusCode PixelDigitizationTool::digitizeEvent(const EventContext& ctx) {
       break;
     }
 
+    ModuleHits module{sielement, firstHit, lastHit};
+    if (m_parallelModules || m_moduleRandomStreams) {
+      // digitized below, once all modules are known
+      modules.push_back(module);
+      continue;
+    }
+
     // Create the charged diodes collection
     chargedDiodes->setDetectorElement(sielement);
-    const InDetDD::PixelModuleDesign* p_design = static_cast<const InDetDD::PixelModuleDesign*>(&(sielement->design()));
 
     ///////////////////////////////////////////////////////////
-    // **** Loop over the hits and created charged diodes ****
+    // ***       Create and store RDO and SDO   ****
     ///////////////////////////////////////////////////////////
-    for (TimedHitCollection<SiHit>::const_iterator phit = firstHit; phit != lastHit; ++phit) {
-      //skip hits which are more than 10us away
-      if (std::abs((*phit)->meanTime()) < 10000.0 * CLHEP::ns) {
-        ATH_MSG_DEBUG("HASH = " <<
-          m_detID->wafer_hash(m_detID->wafer_id((*phit)->getBarrelEndcap(), (*phit)->getLayerDisk(),
-                                                (*phit)->getPhiModule(), (*phit)->getEtaModule())));
-
-        // Apply charge collection tools
-        ATH_MSG_DEBUG("Running sensor simulation.");
-
-        //Deposit energy in sensor
-        ATH_CHECK(m_energyDepositionTool->depositEnergy(*phit, *sielement, trfHitRecord, initialConditions,
-                                                        rndmEngine, ctx));
-
-        //Create signal in sensor, loop over collection of loaded sensorTools
-        for (unsigned int itool = 0; itool < m_chargeTool.size(); itool++) {
-          ATH_MSG_DEBUG("Executing tool " << m_chargeTool[itool]->name());
-          if (m_chargeTool[itool]->induceCharge(*phit, *chargedDiodes, *sielement, *p_design, trfHitRecord,
-                                                initialConditions, rndmEngine, ctx) == StatusCode::FAILURE) {
-            break;
-          }
-        }
-        initialConditions.clear();
-        trfHitRecord.clear();
-        ATH_MSG_DEBUG("charges filled!");
-      }
-    }
-
-    ATH_MSG_DEBUG("Hit collection ID=" << m_detID->show_to_string(chargedDiodes->identify()));
-    ATH_MSG_DEBUG("in digitize elements with hits: ec - layer - eta - phi  " <<
-      m_detID->barrel_ec(chargedDiodes->identify()) << " - " << m_detID->layer_disk(
-                    chargedDiodes->identify()) << " - " << m_detID->eta_module(
-                    chargedDiodes->identify()) << " - " << m_detID->phi_module(chargedDiodes->identify()));
+    PixelRDO_Collection* RDOColl = new PixelRDO_Collection(chargedDiodes->identifyHash());
+    RDOColl->setIdentifier(chargedDiodes->identify());
+    ATH_CHECK(simulateModule(module, *chargedDiodes, *RDOColl, rndmEngine, ctx));
 
     IdentifierHash idHash = chargedDiodes->identifyHash();
 
     assert(idHash < processedElements.size());
     processedElements[idHash] = true;
 
-    ///////////////////////////////////////////////////////////
-    // ***       Create and store RDO and SDO   ****
-    ///////////////////////////////////////////////////////////
-    PixelRDO_Collection* RDOColl = new PixelRDO_Collection(chargedDiodes->identifyHash());
-    RDOColl->setIdentifier(chargedDiodes->identify());
-    for (unsigned int itool = 0; itool < m_fesimTool.size(); itool++) {
-      ATH_MSG_DEBUG("Executing tool " << m_fesimTool[itool]->name());
-      m_fesimTool[itool]->process(*chargedDiodes, *RDOColl, rndmEngine);
-    }
     ATH_CHECK(m_rdoContainer->addCollection(RDOColl, RDOColl->identifyHash()));
 
     ATH_MSG_DEBUG("Pixel RDOs '" << RDOColl->identifyHash() << "' added to container");
     addSDO(chargedDiodes.get());
     chargedDiodes->clear();
   }
+  if (m_parallelModules || m_moduleRandomStreams) {
+    ATH_CHECK(digitizeModules(modules, processedElements, ctx));
+  }
   delete m_timedHits;
   m_timedHits = nullptr;
   ATH_MSG_DEBUG("hits processed");
@@ -270,6 +245,129 @@ StatusCode PixelDigitizationTool::digitizeEvent(const EventContext& ctx) {
   return StatusCode::SUCCESS;
 }
 
+//=======================================
+// S I M U L A T E   M O D U L E
+//=======================================
+StatusCode PixelDigitizationTool::simulateModule(const ModuleHits& module,
+                                                 SiChargedDiodeCollection& chargedDiodes,
+                                                 PixelRDO_Collection& rdoCollection,
+                                                 CLHEP::HepRandomEngine* rndmEngine,
+                                                 const EventContext& ctx) {
+  const InDetDD::SiDetectorElement& sielement = *module.element;
+  const InDetDD::PixelModuleDesign* p_design = static_cast<const InDetDD::PixelModuleDesign*>(&(sielement.design()));
+
+  std::vector<std::pair<double, double> > trfHitRecord;
+  std::vector<double> initialConditions;
+
+  ///////////////////////////////////////////////////////////
+  // **** Loop over the hits and created charged diodes ****
+  ///////////////////////////////////////////////////////////
+  for (TimedHitCollection<SiHit>::const_iterator phit = module.firstHit; phit != module.lastHit; ++phit) {
+    //skip hits which are more than 10us away
+    if (std::abs((*phit)->meanTime()) < 10000.0 * CLHEP::ns) {
+      ATH_MSG_DEBUG("HASH = " <<
+        m_detID->wafer_hash(m_detID->wafer_id((*phit)->getBarrelEndcap(), (*phit)->getLayerDisk(),
+                                              (*phit)->getPhiModule(), (*phit)->getEtaModule())));
+
+      // Apply charge collection tools
+      ATH_MSG_DEBUG("Running sensor simulation.");
+
+      //Deposit energy in sensor
+      ATH_CHECK(m_energyDepositionTool->depositEnergy(*phit, sielement, trfHitRecord, initialConditions,
+                                                      rndmEngine, ctx));
+
+      //Create signal in sensor, loop over collection of loaded sensorTools
+      for (unsigned int itool = 0; itool < m_chargeTool.size(); itool++) {
+        ATH_MSG_DEBUG("Executing tool " << m_chargeTool[itool]->name());
+        if (m_chargeTool[itool]->induceCharge(*phit, chargedDiodes, sielement, *p_design, trfHitRecord,
+                                              initialConditions, rndmEngine, ctx) == StatusCode::FAILURE) {
+          break;
+        }
+      }
+      initialConditions.clear();
+      trfHitRecord.clear();
+      ATH_MSG_DEBUG("charges filled!");
+    }
+  }
+
+  ATH_MSG_DEBUG("Hit collection ID=" << m_detID->show_to_string(chargedDiodes.identify()));
+  ATH_MSG_DEBUG("in digitize elements with hits: ec - layer - eta - phi  " <<
+    m_detID->barrel_ec(chargedDiodes.identify()) << " - " << m_detID->layer_disk(
+                  chargedDiodes.identify()) << " - " << m_detID->eta_module(
+                  chargedDiodes.identify()) << " - " << m_detID->phi_module(chargedDiodes.identify()));
+
+  for (unsigned int itool = 0; itool < m_fesimTool.size(); itool++) {
+    ATH_MSG_DEBUG("Executing tool " << m_fesimTool[itool]->name());
+    m_fesimTool[itool]->process(chargedDiodes, rdoCollection, rndmEngine);
+  }
+  return StatusCode::SUCCESS;
+}
+
+//=======================================
+// D I G I T I Z E   M O D U L E S
+//=======================================
+StatusCode PixelDigitizationTool::digitizeModules(const std::vector<ModuleHits>& modules,
+                                                  std::vector<bool>& processedElements,
+                                                  const EventContext& ctx) {
+  const std::size_t nModules = modules.size();
+  std::vector<std::unique_ptr<SiChargedDiodeCollection> > chargedDiodes(nModules);
+  std::vector<std::unique_ptr<PixelRDO_Collection> > rdoCollections(nModules);
+  std::atomic<bool> failed{false};
+
+  // Random number streams depend only on the event and the module, not on the task scheduling
+  uint64_t eventSeed = CxxUtils::crc64(randomStreamName());
+  eventSeed = CxxUtils::crc64addint(eventSeed, ctx.eventID().event_number());
+  eventSeed = CxxUtils::crc64addint(eventSeed, ctx.eventID().run_number());
+
+  auto digitizeRange = [&](const tbb::blocked_range<std::size_t>& range) {
+    // The tools read conditions through the current context, which is per thread
+    const EventContext oldContext = Gaudi::Hive::currentContext();
+    Gaudi::Hive::setCurrentContext(ctx);
+    for (std::size_t i = range.begin(); i != range.end(); ++i) {
+      const uint64_t seed = CxxUtils::crc64addint(eventSeed, modules[i].element->identifyHash());
+      const long seeds[2] = {static_cast<long>(seed & 0x7fffffff), static_cast<long>((seed >> 32) & 0x7fffffff)};
+      CLHEP::MixMaxRng rndmEngine;
+      rndmEngine.setSeeds(seeds, 2);
+
+      chargedDiodes[i] = std::make_unique<SiChargedDiodeCollection>();
+      chargedDiodes[i]->setDetectorElement(modules[i].element);
+      rdoCollections[i] = std::make_unique<PixelRDO_Collection>(chargedDiodes[i]->identifyHash());
+      rdoCollections[i]->setIdentifier(chargedDiodes[i]->identify());
+      if (simulateModule(modules[i], *chargedDiodes[i], *rdoCollections[i], &rndmEngine, ctx).isFailure()) {
+        failed = true;
+      }
+    }
+    Gaudi::Hive::setCurrentContext(oldContext);
+  };
+  if (m_parallelModules) {
+    // isolate, such that this thread does not pick up unrelated tasks while waiting
+    tbb::this_task_arena::isolate([&]() {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nModules), digitizeRange);
+    });
+  } else {
+    digitizeRange(tbb::blocked_range<std::size_t>(0, nModules));
+  }
+  if (failed) {
+    ATH_MSG_ERROR("Digitization of pixel modules failed");
+    return StatusCode::FAILURE;
+  }
+
+  // Store RDOs and SDOs in module order
+  for (std::size_t i = 0; i < nModules; ++i) {
+    IdentifierHash idHash = chargedDiodes[i]->identifyHash();
+    assert(idHash < processedElements.size());
+    processedElements[idHash] = true;
+    ATH_CHECK(m_rdoContainer->addCollection(rdoCollections[i].release(), idHash));
+    ATH_MSG_DEBUG("Pixel RDOs '" << idHash << "' added to container");
+    addSDO(chargedDiodes[i].get());
+  }
+  return StatusCode::SUCCESS;
+}
+
+const std::string& PixelDigitizationTool::randomStreamName() const {
+  return m_randomStreamName.value().empty() ? name() : m_randomStreamName.value();
+}
+
 //=======================================
 // A D D   S D O
 //=======================================
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file PixelDigitization/PixelDigitizationTool.h
@@ -51,6 +51,28 @@ public:
 protected:
   void addSDO(SiChargedDiodeCollection* collection);
 private:
+  /// Module with hits and the range of its hits in m_timedHits
+  struct ModuleHits {
+    const InDetDD::SiDetectorElement* element;
+    TimedHitCollection<SiHit>::const_iterator firstHit;
+    TimedHitCollection<SiHit>::const_iterator lastHit;
+  };
+
+  /// Create the charged diodes of one module from its hits and run the front-end simulation
+  StatusCode simulateModule(const ModuleHits& module,
+                            SiChargedDiodeCollection& chargedDiodes,
+                            PixelRDO_Collection& rdoCollection,
+                            CLHEP::HepRandomEngine* rndmEngine,
+                            const EventContext& ctx);
+
+  /// Digitize the modules with one random number stream per module, in parallel tasks if ParallelModules is set
+  StatusCode digitizeModules(const std::vector<ModuleHits>& modules,
+                             std::vector<bool>& processedElements,
+                             const EventContext& ctx);
+
+  /// Name seeding the random number streams
+  const std::string& randomStreamName() const;
+
   PixelDigitizationTool();
   PixelDigitizationTool(const PixelDigitizationTool&);
   PixelDigitizationTool& operator = (const PixelDigitizationTool&);
@@ -86,6 +108,17 @@ private:
   Gaudi::Property<bool>                      m_onlyHitElements {
     this, "OnlyHitElements", false, "Process only elements with hits"
   };
+  Gaudi::Property<bool>                      m_parallelModules {
+    this, "ParallelModules", false,
+    "Digitize modules with hits in parallel tasks, seeding a random number stream per module from the event and module hash"
+  };
+  Gaudi::Property<bool>                      m_moduleRandomStreams {
+    this, "ModuleRandomStreams", false,
+    "Digitize modules with hits serially, but with the random number stream per module used by ParallelModules"
+  };
+  Gaudi::Property<std::string>               m_randomStreamName {
+    this, "RandomStreamName", "", "Name seeding the random number streams, the tool name if empty"
+  };
 
   const PixelID* m_detID {};
 
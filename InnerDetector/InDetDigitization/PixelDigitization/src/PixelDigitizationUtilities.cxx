@@ -74,7 +74,7 @@ namespace PixelDigitization{
  
     }
  
-    iData.logHighestCrossSectionsVector.push_back(iData.logIntegratedCrossSectionsVectorOfVector.back().back());
+    iData.updateAfterLastEntry();
  
     return iData;
  
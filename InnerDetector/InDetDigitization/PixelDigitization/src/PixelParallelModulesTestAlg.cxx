@@ -0,0 +1,66 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#undef NDEBUG
+
+#include "PixelParallelModulesTestAlg.h"
+#include "StoreGate/ReadHandle.h"
+
+#include <cassert>
+#include <iostream>
+
+StatusCode PixelParallelModulesTestAlg::initialize() {
+  ATH_CHECK(m_serialKey.initialize());
+  ATH_CHECK(m_parallelKey.initialize());
+  return StatusCode::SUCCESS;
+}
+
+StatusCode PixelParallelModulesTestAlg::test1(const EventContext& ctx) const {
+  std::cout << "test1\n";
+
+  SG::ReadHandle<PixelRDO_Container> serial(m_serialKey, ctx);
+  SG::ReadHandle<PixelRDO_Container> parallel(m_parallelKey, ctx);
+  assert(serial.isValid());
+  assert(parallel.isValid());
+
+  if (serial->numberOfCollections() != parallel->numberOfCollections()) {
+    std::cout << "Collection count mismatch " << serial->numberOfCollections() << " "
+              << parallel->numberOfCollections() << "\n";
+  }
+
+  std::size_t nRDOs = 0;
+  for (const PixelRDO_Collection* serialColl : *serial) {
+    const IdentifierHash idHash = serialColl->identifyHash();
+    const PixelRDO_Collection* parallelColl = parallel->indexFindPtr(idHash);
+    if (!parallelColl) {
+      std::cout << "Missing collection mismatch " << idHash << "\n";
+      continue;
+    }
+    if (serialColl->size() != parallelColl->size()) {
+      std::cout << "Size mismatch " << idHash << " " << serialColl->size() << " "
+                << parallelColl->size() << "\n";
+      continue;
+    }
+    for (std::size_t i = 0; i < serialColl->size(); ++i) {
+      const PixelRDORawData* rdo1 = (*serialColl)[i];
+      const PixelRDORawData* rdo2 = (*parallelColl)[i];
+      if (rdo1->identify() != rdo2->identify() || rdo1->getWord() != rdo2->getWord()) {
+        std::cout << "RDO mismatch " << idHash << " " << i << " "
+                  << rdo1->identify().get_compact() << " " << rdo1->getWord() << " "
+                  << rdo2->identify().get_compact() << " " << rdo2->getWord() << "\n";
+      }
+      ++nRDOs;
+    }
+  }
+
+  // Make sure the comparison is not trivial.
+  assert(nRDOs > 0);
+
+  return StatusCode::SUCCESS;
+}
+
+StatusCode PixelParallelModulesTestAlg::execute() {
+  ATH_CHECK(test1(Gaudi::Hive::currentContext()));
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file PixelDigitization/PixelParallelModulesTestAlg.h
+ * @date October, 2022
+ * @brief Regression test for PixelDigitizationTool: digitizing the modules
+ *        in parallel must give the same RDOs as digitizing them serially
+ *        with the same per-module random number streams.
+ */
+
+#ifndef PIXELDIGITIZATION_PIXELPARALLELMODULESTESTALG_H
+#define PIXELDIGITIZATION_PIXELPARALLELMODULESTESTALG_H
+
+#include "AthenaBaseComps/AthAlgorithm.h"
+#include "InDetRawData/PixelRDO_Container.h"
+#include "StoreGate/ReadHandleKey.h"
+
+class PixelParallelModulesTestAlg: public AthAlgorithm {
+public:
+  using AthAlgorithm::AthAlgorithm;
+
+  virtual StatusCode initialize() override;
+  virtual StatusCode execute() override;
+private:
+  StatusCode test1(const EventContext& ctx) const;
+
+  SG::ReadHandleKey<PixelRDO_Container> m_serialKey {
+    this, "SerialRDOs", "PixelRDOs_Serial", "RDOs of the serial digitization"
+  };
+  SG::ReadHandleKey<PixelRDO_Container> m_parallelKey {
+    this, "ParallelRDOs", "PixelRDOs_Parallel", "RDOs of the parallel digitization"
+  };
+};
+
+#endif // PIXELDIGITIZATION_PIXELPARALLELMODULESTESTALG_H
@@ -135,8 +135,6 @@ StatusCode SensorSim3DTool::induceCharge(const TimedHitPtr<SiHit>& phit,
     const PixelRadiationDamageFluenceMapData *fluenceData = *fluenceDataHandle;
 
     std::pair < double, double > trappingTimes = m_radDamageUtil->getTrappingTimes(fluenceData->getFluenceLayer3D(0));   //0 = IBL
-    m_trappingTimeElectrons = trappingTimes.first;
-    m_trappingTimeHoles = trappingTimes.second;
 
     const PixelHistoConverter& ramoPotentialMap = fluenceData->getRamoPotentialMap3D(0);
     const PixelHistoConverter& eFieldMap        = fluenceData->getEFieldMap3D(0);
@@ -215,8 +213,8 @@ StatusCode SensorSim3DTool::induceCharge(const TimedHitPtr<SiHit>& phit,
 
       const double mobilityElectron = getMobility(efield, false);
       const double mobilityHole     = getMobility(efield, true);
-      auto driftTimeElectron = getDriftTime(false, ncharges, rndmEngine);
-      auto driftTimeHole = getDriftTime(true, ncharges, rndmEngine);
+      auto driftTimeElectron = getDriftTime(trappingTimes.first, ncharges, rndmEngine);
+      auto driftTimeHole = getDriftTime(trappingTimes.second, ncharges, rndmEngine);
       //Need to determine how many elementary charges this charge chunk represents.
       double chunk_size = energy_per_step * eleholePairEnergy; //number of electrons/holes
       //set minimum limit to prevent dividing into smaller subcharges than one fundamental charge
@@ -706,18 +704,14 @@ double SensorSim3DTool::getMobility(double electricField, bool isHoleBit) {
   return mobility; // mm^2/(MV*ns)
 }
 
-std::vector<double> SensorSim3DTool::getDriftTime(bool isHoleBit, size_t n,
-                                                  CLHEP::HepRandomEngine* rndmEngine)
+std::vector<double> SensorSim3DTool::getDriftTime(double trappingTime, size_t n,
+                                                  CLHEP::HepRandomEngine* rndmEngine) const
 {
   std::vector<double> rand (n, 0.);
   std::vector<double> result (n, 0.);
   CLHEP::RandFlat::shootArray(rndmEngine, n, rand.data(), 0., 1.);
   for(size_t i = 0; i < n; i++) {
-    if (isHoleBit) {
-      result[i]= (-1.) * m_trappingTimeHoles * logf(rand[i]); // ns
-    } else {
-      result[i] = (-1.) * m_trappingTimeElectrons * logf(rand[i]); // ns
-    }
+    result[i] = (-1.) * trappingTime * logf(rand[i]); // ns
   }
   return result;
 }
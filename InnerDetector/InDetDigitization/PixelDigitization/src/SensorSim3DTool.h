@@ -42,8 +42,9 @@ public:
   StatusCode printProbMap(const std::string&) const;
 
   double getMobility(double electricField, bool isHoleBit);
-  std::vector<double> getDriftTime(bool isHoleBit, size_t number,
-                                   CLHEP::HepRandomEngine* rndmEngine);
+  /// Random drift times until trapping, for a characteristic trapping time
+  std::vector<double> getDriftTime(double trappingTime, size_t number,
+                                   CLHEP::HepRandomEngine* rndmEngine) const;
 
 private:
   SensorSim3DTool();
@@ -76,16 +77,6 @@ private:
     this, "doChunkCorrection", false, "doChunkCorrection bool: should be flag"
   };
 
-  Gaudi::Property<double> m_trappingTimeElectrons
-  {
-    this, "trappingTimeElectrons", 0.0, "Characteristic time till electron is trapped [ns]"
-  };
-
-  Gaudi::Property<double> m_trappingTimeHoles
-  {
-    this, "trappingTimeHoles", 0.0, "Characteristic time till hole is trapped [ns]"
-  };
-
   Gaudi::Property<double> m_temperature
   {
     this, "Temperature", 300.0, "Default temperature [K]"
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -47,18 +47,12 @@ private:
   std::vector<PixelHistoConverter> m_distanceMap_h;
   std::vector<PixelHistoConverter> m_lorentzMap_e;
   std::vector<PixelHistoConverter> m_lorentzMap_h;
-  std::vector<std::pair<double,double> > m_centrePixelNNEtaPhi;
 
   Gaudi::Property<int> m_numberOfSteps
   {
     this, "numberOfSteps", 50, "Geant4:number of steps for PixelPlanar"
   };
 
-  Gaudi::Property<double> m_diffusionConstant
-  {
-    this, "diffusionConstant", 0.0, "Geant4:Diffusion Constant for PixelPlanar"
-  };
-
   Gaudi::Property<bool> m_doInterpolateEfield
   {
     this, "doInterpolateEfield", false, "doInterpolateEfield bool: should be flag"
@@ -8,6 +8,7 @@
 #include "src/FEI3SimTool.h"
 #include "src/RadDamageUtil.h"
 #include "src/EfieldInterpolator.h"
+#include "src/PixelParallelModulesTestAlg.h"
 
 DECLARE_COMPONENT( PixelDigitization )
 DECLARE_COMPONENT( EnergyDepositionTool )
@@ -19,4 +20,5 @@ DECLARE_COMPONENT( FEI4SimTool )
 DECLARE_COMPONENT( FEI3SimTool )
 DECLARE_COMPONENT( RadDamageUtil )
 DECLARE_COMPONENT( EfieldInterpolator )
+DECLARE_COMPONENT( PixelParallelModulesTestAlg )
 
@@ -20,6 +20,9 @@ ATLAS_NO_CHECK_FILE_THREAD_SAFETY;
 #include <utility> //pair
 #include <tuple>
 #include <ostream>
+#include <vector>
+#include <random>
+#include <chrono>
 
 namespace utf = boost::unit_test;
 namespace tt  = boost::test_tools;
@@ -92,4 +95,65 @@ BOOST_AUTO_TEST_SUITE(BichselDataTest)
     BOOST_CHECK(d.interpolateCollisionEnergy(validIndices,validBetaGamma) == -1. );
     BOOST_CHECK_EQUAL(d.interpolateCrossSection(validIndices, validBetaGamma), 7943.2823472428136 );
   }
+  BOOST_AUTO_TEST_CASE(BatchedCollisionEnergyTest){
+    BichselData d;
+    d.addEntry(-1., 1.68, 0.6);
+    d.addEntry(-1., 1.74, 1.8);
+    d.addEntry(-1., 1.80, 3.0);
+    d.addEntry(-1., 1.86, 4.2);
+    d.addEntry(-0.8, 2.8, 6.);
+    d.addEntry(-0.8, 2.9, 7.);
+    d.updateAfterLastEntry();
+    BOOST_TEST_MESSAGE("Checks batched collision energies against the single value interpolation");
+    BOOST_CHECK(d.rowOffsets.size() == 3);
+    BOOST_CHECK(d.flatLogIntegratedCrossSections.size() == 6);
+    const auto indices = d.getBetaGammaIndices(-0.9);
+    std::vector<double> intX{std::pow(10., 0.5), std::pow(10., 0.7), std::pow(10., 2.), std::pow(10., 3.5), std::pow(10., 4.3)};
+    std::vector<double> energies(intX);
+    d.interpolateCollisionEnergies(indices.second, energies.data(), energies.size());
+    for (size_t i = 0; i < intX.size(); ++i) {
+      BOOST_TEST(energies[i] == d.interpolateCollisionEnergy(indices, std::log10(intX[i])), tt::tolerance(1e-12));
+    }
+    //outside of the table
+    BOOST_CHECK(energies[0] == -1.);
+    BOOST_CHECK(energies[4] == -1.);
+    //invalid row
+    d.interpolateCollisionEnergies(-1, energies.data(), energies.size());
+    BOOST_CHECK(energies[2] == -1.);
+  }
+  BOOST_AUTO_TEST_CASE(BatchedCollisionEnergyTiming){
+    //fine table, similar in size to the Bichsel data files
+    BichselData d;
+    for (int iRow = 0; iRow < 10; ++iRow){
+      for (int i = 0; i < 200; ++i){
+        d.addEntry(-1. + 0.2 * iRow, 1. + 0.03 * i, 0.5 + 0.02 * i + 0.0001 * i * i);
+      }
+    }
+    d.updateAfterLastEntry();
+    const auto indices = d.getBetaGammaIndices(0.1);
+    const double upperBound = d.interpolateCrossSection(indices, 0.1);
+    std::mt19937_64 engine(12345);
+    std::uniform_real_distribution<double> flat(0., upperBound);
+    const size_t n = 100000;
+    std::vector<double> intX(n);
+    for (double & x : intX) x = flat(engine);
+    //
+    std::vector<double> scalarEnergies(n);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) {
+      scalarEnergies[i] = d.interpolateCollisionEnergy(indices, std::log10(intX[i]));
+    }
+    auto scalarTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::vector<double> batchedEnergies(intX);
+    start = std::chrono::steady_clock::now();
+    d.interpolateCollisionEnergies(indices.second, batchedEnergies.data(), n);
+    auto batchedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    BOOST_TEST_MESSAGE("Collision energies for "<<n<<" samples, single: "<<scalarTime.count()<<"us, batched: "<<batchedTime.count()<<"us");
+    //same samples give the same energies, up to rounding
+    size_t nDifferent = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (std::abs(scalarEnergies[i] - batchedEnergies[i]) > 1e-9 * std::abs(scalarEnergies[i])) ++nDifferent;
+    }
+    BOOST_CHECK(nDifferent == 0);
+  }
 BOOST_AUTO_TEST_SUITE_END()
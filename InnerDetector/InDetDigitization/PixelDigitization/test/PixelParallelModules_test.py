@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+"""Test that PixelDigitizationTool gives the same RDOs with ParallelModules=True
+as when digitizing the modules serially with the same per-module random number streams.
+
+Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+"""
+import sys
+from AthenaConfiguration.AllConfigFlags import ConfigFlags
+from AthenaConfiguration.ComponentFactory import CompFactory
+from AthenaConfiguration.MainServicesConfig import MainServicesCfg
+from AthenaConfiguration.TestDefaults import defaultTestFiles
+from AthenaPoolCnvSvc.PoolReadConfig import PoolReadCfg
+from SGComps.SGInputLoaderConfig import SGInputLoaderCfg
+from PixelDigitization.PixelDigitizationConfig import PixelDigitizationBasicToolCfg
+
+
+def PixelDigitizationModulesCfg(flags, name, suffix, **kwargs):
+    """Return ComponentAccumulator with a PixelDigitization algorithm writing PixelRDOs_<suffix>"""
+    kwargs.setdefault("PileUpMergeSvc", '')
+    kwargs.setdefault("OnlyUseContainerName", False)
+    kwargs.setdefault("RDOCollName", "PixelRDOs_" + suffix)
+    kwargs.setdefault("SDOCollName", "PixelSDO_Map_" + suffix)
+    # both tools must be seeded alike
+    kwargs.setdefault("RandomStreamName", "PixelDigitizationTool")
+    acc = PixelDigitizationBasicToolCfg(flags, name + "Tool", **kwargs)
+    tool = acc.popPrivateTools()
+    acc.addEventAlgo(CompFactory.PixelDigitization(name, DigitizationTool=tool))
+    return acc
+
+
+ConfigFlags.Input.Files = defaultTestFiles.HITS_RUN2
+ConfigFlags.IOVDb.GlobalTag = "OFLCOND-MC16-SDR-16"
+ConfigFlags.GeoModel.Align.Dynamic = False
+ConfigFlags.Beam.NumberOfCollisions = 0.
+ConfigFlags.Concurrency.NumThreads = 2
+ConfigFlags.lock()
+
+acc = MainServicesCfg(ConfigFlags)
+acc.merge(PoolReadCfg(ConfigFlags))
+acc.merge(SGInputLoaderCfg(ConfigFlags, ["SiHitCollection#PixelHits"]))
+acc.merge(PixelDigitizationModulesCfg(ConfigFlags, "PixelDigitizationSerial", "Serial",
+                                      ModuleRandomStreams=True))
+acc.merge(PixelDigitizationModulesCfg(ConfigFlags, "PixelDigitizationParallel", "Parallel",
+                                      ParallelModules=True))
+acc.addEventAlgo(CompFactory.PixelParallelModulesTestAlg("PixelParallelModulesTestAlg"))
+
+sc = acc.run(maxEvents=1)
+sys.exit(not sc.isSuccess())
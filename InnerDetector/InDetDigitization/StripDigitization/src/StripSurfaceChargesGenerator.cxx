@@ -194,35 +194,55 @@ StatusCode StripSurfaceChargesGenerator::finalize() {
 }
 
 // ----------------------------------------------------------------------
-// perpandicular Drift time calculation
+// Sensor quantities needed for the drift time and diffusion
 // ----------------------------------------------------------------------
-float StripSurfaceChargesGenerator::driftTime(float zhit, const SiDetectorElement* element, const EventContext& ctx) const {
+bool StripSurfaceChargesGenerator::driftParameters(const SiDetectorElement* element, const EventContext& ctx, DriftParameters& params) const {
   if (element==nullptr) {
     ATH_MSG_ERROR("StripSurfaceChargesGenerator::process element is nullptr");
-    return -2.0;
+    return false;
   }
   const SCT_ModuleSideDesign* design{dynamic_cast<const SCT_ModuleSideDesign*>(&(element->design()))};
   if (design==nullptr) {
     ATH_MSG_ERROR("StripSurfaceChargesGenerator::process can not get " << design);
-    return -2.0;
+    return false;
   }
-  const double thickness{design->thickness()};
+  params.thickness = design->thickness();
   const IdentifierHash hashId{element->identifyHash()};
 
+  if (m_useSiCondDB) {
+    params.depletionVoltage = m_siConditionsTool->depletionVoltage(hashId, ctx) * CLHEP::volt;
+    params.biasVoltage = m_siConditionsTool->biasVoltage(hashId, ctx) * CLHEP::volt;
+  } else {
+    params.depletionVoltage = m_vdepl * CLHEP::volt;
+    params.biasVoltage = m_vbias * CLHEP::volt;
+  }
+
+  const InDet::SiliconProperties& siProperties{m_siPropertiesTool->getSiProperties(hashId, ctx)};
+  params.driftTimeFactor = params.thickness * params.thickness / (2.0 * siProperties.holeDriftMobility() * params.depletionVoltage);
+  params.holeDiffusionConstant = siProperties.holeDiffusionConstant();
+  return true;
+}
+
+// ----------------------------------------------------------------------
+// perpandicular Drift time calculation
+// ----------------------------------------------------------------------
+float StripSurfaceChargesGenerator::driftTime(float zhit, const SiDetectorElement* element, const EventContext& ctx) const {
+  DriftParameters params;
+  if (not driftParameters(element, ctx, params)) {
+    return -2.0;
+  }
+  return driftTime(zhit, params);
+}
+
+float StripSurfaceChargesGenerator::driftTime(float zhit, const DriftParameters& params) const {
+  const double thickness{params.thickness};
   if ((zhit < 0.0) or (zhit > thickness)) {
     ATH_MSG_DEBUG("driftTime: hit coordinate zhit=" << zhit / CLHEP::micrometer << " out of range");
     return -2.0;
   }
 
-  float depletionVoltage{0.};
-  float biasVoltage{0.};
-  if (m_useSiCondDB) {
-    depletionVoltage = m_siConditionsTool->depletionVoltage(hashId, ctx) * CLHEP::volt;
-    biasVoltage = m_siConditionsTool->biasVoltage(hashId, ctx) * CLHEP::volt;
-  } else {
-    depletionVoltage = m_vdepl * CLHEP::volt;
-    biasVoltage = m_vbias * CLHEP::volt;
-  }
+  const float depletionVoltage{params.depletionVoltage};
+  const float biasVoltage{params.biasVoltage};
 
   const float denominator{static_cast<float>(depletionVoltage + biasVoltage - (2.0 * zhit * depletionVoltage / thickness))};
   if (denominator <= 0.0) {
@@ -238,7 +258,7 @@ float StripSurfaceChargesGenerator::driftTime(float zhit, const SiDetectorElemen
   }
 
   float t_drift{std::log((depletionVoltage + biasVoltage) / denominator)};
-  t_drift *= thickness * thickness / (2.0 * m_siPropertiesTool->getSiProperties(hashId, ctx).holeDriftMobility() * depletionVoltage);
+  t_drift *= params.driftTimeFactor;
   return t_drift;
 }
 
@@ -250,11 +270,18 @@ float StripSurfaceChargesGenerator::diffusionSigma(float zhit, const SiDetectorE
     ATH_MSG_ERROR("StripSurfaceChargesGenerator::diffusionSigma element is nullptr");
     return 0.0;
   }
-  const IdentifierHash hashId{element->identifyHash()};
-  const float t{driftTime(zhit, element, ctx)}; // in ns
+  DriftParameters params;
+  if (not driftParameters(element, ctx, params)) {
+    return 0.0;
+  }
+  return diffusionSigma(zhit, params);
+}
+
+float StripSurfaceChargesGenerator::diffusionSigma(float zhit, const DriftParameters& params) const {
+  const float t{driftTime(zhit, params)}; // in ns
 
   if (t > 0.0) {
-    const float sigma{static_cast<float>(std::sqrt(2. * m_siPropertiesTool->getSiProperties(hashId, ctx).holeDiffusionConstant() * t))}; // in mm
+    const float sigma{static_cast<float>(std::sqrt(2. * params.holeDiffusionConstant * t))}; // in mm
     return sigma;
   } else {
     return 0.0;
@@ -397,6 +424,12 @@ void StripSurfaceChargesGenerator::processSiHit(const SiDetectorElement* element
   const float e1{static_cast<float>(phit.energyLoss() / steps)};
   const float q1{static_cast<float>(e1 * m_siPropertiesTool->getSiProperties(hashId, ctx).electronHolePairsPerEnergy())};
 
+  // Drift time and diffusion of all steps are computed from the same sensor quantities
+  DriftParameters driftParams;
+  if (not driftParameters(element, ctx, driftParams)) {
+    return;
+  }
+
   // NB this is different to the SCT, where this would be
   //float xhit{xEta};
   //float yhit{xPhi};
@@ -473,7 +506,7 @@ void StripSurfaceChargesGenerator::processSiHit(const SiDetectorElement* element
       h.m_h_spess->Fill(spess);
     }
 
-    float t_drift{driftTime(zReadout, element, ctx)};  // !< t_drift: perpandicular drift time
+    float t_drift{driftTime(zReadout, driftParams)};  // !< t_drift: perpandicular drift time
     if (t_drift>-2.0000002 and t_drift<-1.9999998) {
       ATH_MSG_DEBUG("Checking for rounding errors in compression");
       if ((std::abs(z1) - 0.5 * thickness) < 0.000010) {
@@ -486,7 +519,7 @@ void StripSurfaceChargesGenerator::processSiHit(const SiDetectorElement* element
           // set new coordinate to be 0.5nm inside wafer volume.
         }
         zReadout = 0.5 * thickness - design->readoutSide() * z1;
-        t_drift = driftTime(zReadout, element, ctx);
+        t_drift = driftTime(zReadout, driftParams);
         if (t_drift>-2.0000002 and t_drift<-1.9999998) {
           ATH_MSG_WARNING("Attempt failed. Making no correction.");
         } else {
@@ -502,7 +535,7 @@ void StripSurfaceChargesGenerator::processSiHit(const SiDetectorElement* element
 
       float sigma{0.};
       if (not m_doInducedChargeModel) {
-        sigma = diffusionSigma(zReadout, element, ctx);
+        sigma = diffusionSigma(zReadout, driftParams);
         y1 += tanLorentz * zReadout; // !< Taking into account the magnetic field
       } // These are treated in Induced Charge Model.
 
@@ -99,6 +99,18 @@ class StripSurfaceChargesGenerator : public extends<AthAlgTool, ISurfaceChargesG
   float maxDriftTime(const InDetDD::SiDetectorElement* element, const EventContext& ctx) const; //!< max drift charge equivalent to the detector thickness
   float maxDiffusionSigma(const InDetDD::SiDetectorElement* element, const EventContext& ctx) const; //!< max sigma diffusion
 
+  /** Sensor quantities entering the drift time and diffusion, looked up once per hit instead of at every step */
+  struct DriftParameters {
+    double thickness{0.};
+    float depletionVoltage{0.};
+    float biasVoltage{0.};
+    double driftTimeFactor{0.}; //!< thickness^2 / (2 * hole drift mobility * depletion voltage)
+    double holeDiffusionConstant{0.};
+  };
+  bool driftParameters(const InDetDD::SiDetectorElement* element, const EventContext& ctx, DriftParameters& params) const;
+  float driftTime(float zhit, const DriftParameters& params) const; //!< as driftTime above, with the sensor quantities given
+  float diffusionSigma(float zhit, const DriftParameters& params) const; //!< as diffusionSigma above, with the sensor quantities given
+
   // trap_pos and drift_time are updated based on spess.
   bool chargeIsTrapped(double spess, const InDetDD::SiDetectorElement* element, double& trap_pos, double& drift_time) const;
 
@@ -55,7 +55,13 @@ def EGammaCaloIsolationToolCfg(flags, **kwargs):
     kwargs.setdefault('ParticleCaloExtensionTool',None)
     kwargs.setdefault('ParticleCaloCellAssociationTool',None)
     kwargs.setdefault('isMC',flags.Input.isMC)
-        
+
+    # cell cones are looked up in the eta-phi cell index, the selection is unchanged
+    if 'CaloCellRoIIndex' not in kwargs:
+        from CaloDetDescr.CaloCellRoIIndexConfig import CaloCellRoIIndexCondAlgCfg
+        acc.merge(CaloCellRoIIndexCondAlgCfg(flags))
+        kwargs['CaloCellRoIIndex'] = 'CaloCellRoIIndex'
+
     acc.setPrivateTools(CompFactory.xAOD.CaloIsolationTool(**kwargs))
     return acc
 
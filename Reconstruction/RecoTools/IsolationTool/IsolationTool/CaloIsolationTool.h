@@ -21,6 +21,7 @@
 #include "TrkCaloExtension/CaloExtensionCollection.h"
 #include "StoreGate/ReadCondHandleKey.h"
 #include "CaloDetDescr/CaloDetDescrManager.h"
+#include "CaloDetDescr/CaloCellRoIIndex.h"
 #endif // XAOD_ANALYSIS
 
 #include "IsolationCorrections/IIsolationCorrectionTool.h"
@@ -302,6 +303,10 @@ namespace xAOD {
 
       /** CaloDetDescrManager from ConditionStore */
       SG::ReadCondHandleKey<CaloDetDescrManager> m_caloMgrKey{this,"CaloDetDescrManager", "CaloDetDescrManager"};
+
+      /** Optional eta-phi cell index from ConditionStore, used for the cell cone selection */
+      SG::ReadCondHandleKey<CaloCellRoIIndex> m_caloRoIIndexKey{this,"CaloCellRoIIndex", "",
+          "Eta-phi cell index (from CaloCellRoIIndexCondAlg); if empty use CaloDetDescrManager lookup"};
 #endif // XAOD_ANALYSIS
 
       /** @brief Tool for pt-corrected isolation calculation (new)*/
@@ -107,6 +107,7 @@ namespace xAOD {
 
     ATH_CHECK(m_caloExtensionKey.initialize(SG::AllowEmpty));
     ATH_CHECK(m_caloMgrKey.initialize());
+    ATH_CHECK(m_caloRoIIndexKey.initialize(SG::AllowEmpty));
 #endif // XAOD_ANALYSIS
 
     if (!m_IsoLeakCorrectionTool.empty())
@@ -907,6 +908,12 @@ for( auto isoType : isoTypes ){
     }
     CaloCellList HADccl(caloDDMgr,container, Vec_HadCaloEnums);
 
+    if (!m_caloRoIIndexKey.empty()) {
+      SG::ReadCondHandle<CaloCellRoIIndex> roiIndexHandle{m_caloRoIIndexKey};
+      EMccl.setRoIIndex(*roiIndexHandle);
+      HADccl.setRoIIndex(*roiIndexHandle);
+    }
+
     // Let's determine some values based on the input specs
     // Search for largest radius
     double Rmax = 0.0;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "StandardFieldSvc.h"
@@ -58,12 +58,13 @@ G4MagneticField* StandardFieldSvc::makeField()
   
   // Either initialize the field map - used for solenoid and toroid, or the field service for the forward field
   if (m_useMagFieldSvc) {
-    af = new AtlasField( &*m_magFieldSvc );
+    af = new AtlasField( &*m_magFieldSvc, m_useLastPointCache );
   }
   else {
     const double scaleSolenoid = m_mapSoleCurrent>0 ? m_useSoleCurrent / m_mapSoleCurrent : 1. ;
     const double scaleToroid    = m_mapToroCurrent>0 ? m_useToroCurrent / m_mapToroCurrent : 1. ;
-    af = new AtlasField(scaleSolenoid, scaleToroid, m_fieldMap.get());
+    if (m_useSolenoidZR) ATH_MSG_INFO( "StandardFieldSvc::makeField: using z-r field map inside the solenoid" );
+    af = new AtlasField(scaleSolenoid, scaleToroid, m_fieldMap.get(), m_useSolenoidZR, m_useLastPointCache);
   }
   
   return (af);
@@ -1,11 +1,13 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef G4ATLASSERVICES_StandardFieldSvc_H
 #define G4ATLASSERVICES_StandardFieldSvc_H
 
 // STL library
+#include <array>
+#include <limits>
 #include <string>
 
 // Geant4
@@ -28,15 +30,22 @@ namespace MagField {
 
 /// @class AtlasField
 /// @brief G4 wrapper around the main ATLAS magnetic field cache or field svc for forward field.
+///
+/// One instance is created per G4 worker thread (see G4MagFieldSvcBase), so
+/// the field cache and the last evaluated point need no locking.
 class AtlasField : public G4MagneticField
 {
   public:
     /// Construct the field object from conditions object
-  AtlasField(double scaleSolenoid, double scaleToroid, const MagField::AtlasFieldMap* fieldMap) {
+    AtlasField(double scaleSolenoid, double scaleToroid, const MagField::AtlasFieldMap* fieldMap,
+               bool useSolenoidZR = false, bool useLastPointCache = true) :
+        m_useSolenoidZR(useSolenoidZR),
+        m_useLastPointCache(useLastPointCache) {
             m_fieldCache = MagField::AtlasFieldCache( scaleSolenoid, scaleToroid, fieldMap);
     }
     /// Construct the field object from the IMagFieldSvc
-    AtlasField(MagField::IMagFieldSvc* m) :
+    AtlasField(MagField::IMagFieldSvc* m, bool useLastPointCache = true) :
+        m_useLastPointCache(useLastPointCache),
         m_magFieldSvc(m)
         {}
             
@@ -46,14 +55,45 @@ class AtlasField : public G4MagneticField
     /// Implementation of G4 method to retrieve field value
     void GetFieldValue(const double *point, double *field) const
     {
-        if (m_magFieldSvc) m_magFieldSvc->getField(point, field);
-        else               m_fieldCache.getField(point, field);
+        // The steppers evaluate the field repeatedly at the same point,
+        // e.g. at the start of a step which is the end of the previous one
+        if (m_useLastPointCache &&
+            point[0] == m_lastPoint[0] && point[1] == m_lastPoint[1] && point[2] == m_lastPoint[2]) {
+            field[0] = m_lastField[0];
+            field[1] = m_lastField[1];
+            field[2] = m_lastField[2];
+            return;
+        }
+
+        if (m_magFieldSvc)       m_magFieldSvc->getField(point, field);
+        else if (m_useSolenoidZR) m_fieldCache.getFieldZR(point, field);
+        else                     m_fieldCache.getField(point, field);
+
+        m_lastPoint[0] = point[0];
+        m_lastPoint[1] = point[1];
+        m_lastPoint[2] = point[2];
+        m_lastField[0] = field[0];
+        m_lastField[1] = field[1];
+        m_lastField[2] = field[2];
     }
 
   private:
     /// Field cache - mutable because getField modifies the cache
     mutable MagField::AtlasFieldCache m_fieldCache ATLAS_THREAD_SAFE;
 
+    /// Last point and field returned by GetFieldValue.
+    /// Initialized with a NaN point, which never compares equal.
+    mutable std::array<double, 3> m_lastPoint ATLAS_THREAD_SAFE {std::numeric_limits<double>::quiet_NaN(),
+                                                                 std::numeric_limits<double>::quiet_NaN(),
+                                                                 std::numeric_limits<double>::quiet_NaN()};
+    mutable std::array<double, 3> m_lastField ATLAS_THREAD_SAFE {0., 0., 0.};
+
+    /// Use the z-r field map inside the solenoid
+    bool m_useSolenoidZR{false};
+
+    /// Return the last field if called again at the same point
+    bool m_useLastPointCache{true};
+
     /// Pointer to the magnetic field service.
     /// We use a raw pointer here to avoid ServiceHandle overhead.
     MagField::IMagFieldSvc* m_magFieldSvc{nullptr};
@@ -93,6 +133,14 @@ class StandardFieldSvc final : public G4MagFieldSvcBase
     // flag to use magnet field service
     Gaudi::Property<bool> m_useMagFieldSvc {this, 
             "UseMagFieldSvc", false, "Use magnetic field service - Should ONLY be used for ForwardRegionFieldSvc"};
+
+    /// flag to use the z-r field map inside the solenoid
+    Gaudi::Property<bool> m_useSolenoidZR {this,
+            "UseSolenoidZRField", false, "Use the phi-symmetric z-r field map inside the solenoid, full 3d map elsewhere"};
+
+    /// flag to reuse the field of the last point
+    Gaudi::Property<bool> m_useLastPointCache {this,
+            "UseLastPointCache", true, "Return the field of the last point without a new lookup if called again at the same point"};
     
     /// Handle to the the Forward ATLAS magnetic field service
     ServiceHandle<MagField::IMagFieldSvc> m_magFieldSvc {this, "MagneticFieldSvc", ""};
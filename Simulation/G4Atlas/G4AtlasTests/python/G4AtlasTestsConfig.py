@@ -1,4 +1,4 @@
-# Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 from AthenaCommon.Logging import logging
 from AthenaConfiguration.ComponentFactory import CompFactory
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
@@ -153,3 +153,9 @@ def TruthTestToolCfg(mcEventKey, name="TruthTestTool", **kwargs):
     TruthTestTool = CompFactory.TruthTestTool
     result.setPrivateTools(TruthTestTool(name=name, **kwargs))
     return result
+
+
+def StepRateMonitorToolCfg(flags, name="G4UA::StepRateMonitorTool", **kwargs):
+    result = ComponentAccumulator()
+    result.setPrivateTools(CompFactory.G4UA.StepRateMonitorTool(name, **kwargs))
+    return result
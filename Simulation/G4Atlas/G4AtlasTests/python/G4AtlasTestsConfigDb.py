@@ -37,4 +37,5 @@ addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.CaloEntryLayerTestTool", "CaloEnt
 addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.MuonEntryLayerTestTool", "MuonEntryLayerTestTool")
 addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.MuonExitLayerTestTool",  "MuonExitLayerTestTool")
 addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.getSteppingValidationTool", "G4UA::SteppingValidationTool")
+addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.getStepRateMonitorTool", "G4UA::StepRateMonitorTool")
 addTool("G4AtlasTests.G4AtlasTestsConfigLegacy.LucidHitsTestTool", "LucidHitsTestTool")
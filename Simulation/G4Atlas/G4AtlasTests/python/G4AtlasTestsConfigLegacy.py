@@ -126,3 +126,7 @@ def getSteppingValidationTool(name="G4UA::SteppingValidationTool",**kwargs):
         return False
     from AtlasGeant4.AtlasGeant4Conf import G4UA__SteppingValidationTool
     return G4UA__SteppingValidationTool(name, **kwargs)
+
+
+def getStepRateMonitorTool(name="G4UA::StepRateMonitorTool", **kwargs):
+    return CfgMgr.G4UA__StepRateMonitorTool(name, **kwargs)
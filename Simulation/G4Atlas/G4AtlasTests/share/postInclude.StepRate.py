@@ -0,0 +1,18 @@
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+#
+# Benchmark of the G4 stepping throughput: prints the number of steps per
+# second of event time in finalize. To compare field configurations, run e.g.
+#   athena.py -c 'EvtMax=100' G4AtlasTests/test_AtlasG4_muons.py G4AtlasTests/postInclude.StepRate.py
+# once as is and once adding UseSolenoidZRField=True to the -c options.
+# UseLastPointCache=False switches off the reuse of the field at the last point.
+
+from G4AtlasApps.SimFlags import simFlags
+simFlags.OptionalUserActionList.addAction('G4UA::StepRateMonitorTool')
+
+if 'UseSolenoidZRField' in dir():
+    from AthenaCommon.CfgGetter import getService
+    getService('StandardField').UseSolenoidZRField = UseSolenoidZRField  # noqa: F821
+
+if 'UseLastPointCache' in dir():
+    from AthenaCommon.CfgGetter import getService
+    getService('StandardField').UseLastPointCache = UseLastPointCache  # noqa: F821
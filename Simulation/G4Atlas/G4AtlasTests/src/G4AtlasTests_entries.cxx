@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2018 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 #include "G4AtlasTests/G4TestAlg.h"
 #include "SiHitsTestTool.h"
@@ -22,6 +22,7 @@
 #include "LayerTestTool.h"
 #include "CaloCalibrationHitsTestTool.h"
 #include "SteppingValidationTool.h"
+#include "StepRateMonitorTool.h"
 #include "LucidHitsTestTool.h"
 #include "CalibHitValidate.h"
 
@@ -46,6 +47,7 @@ DECLARE_COMPONENT( ZDCHitsTestTool )
 DECLARE_COMPONENT( CaloCalibrationHitsTestTool )
 DECLARE_COMPONENT( LayerTestTool )
 DECLARE_COMPONENT( G4UA::SteppingValidationTool )
+DECLARE_COMPONENT( G4UA::StepRateMonitorTool )
 DECLARE_COMPONENT( G4TestAlg )
 DECLARE_COMPONENT( CalibHitValidate )
 DECLARE_COMPONENT( LucidHitsTestTool )
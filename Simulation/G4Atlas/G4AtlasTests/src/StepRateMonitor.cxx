@@ -0,0 +1,38 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "StepRateMonitor.h"
+
+namespace G4UA
+{
+
+  //----------------------------------------------------------------------------
+  void StepRateMonitor::Report::merge(const StepRateMonitor::Report& rep)
+  {
+    nEvents += rep.nEvents;
+    nSteps += rep.nSteps;
+    eventTime += rep.eventTime;
+  }
+
+  //----------------------------------------------------------------------------
+  void StepRateMonitor::BeginOfEventAction(const G4Event*)
+  {
+    m_eventStart = std::chrono::steady_clock::now();
+  }
+
+  //----------------------------------------------------------------------------
+  void StepRateMonitor::EndOfEventAction(const G4Event*)
+  {
+    const std::chrono::duration<double> dt = std::chrono::steady_clock::now() - m_eventStart;
+    m_report.eventTime += dt.count();
+    ++m_report.nEvents;
+  }
+
+  //----------------------------------------------------------------------------
+  void StepRateMonitor::UserSteppingAction(const G4Step*)
+  {
+    ++m_report.nSteps;
+  }
+
+} // namespace G4UA
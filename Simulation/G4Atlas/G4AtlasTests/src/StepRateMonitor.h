@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef G4ATLASTESTS_G4UA__STEPRATEMONITOR_H
+#define G4ATLASTESTS_G4UA__STEPRATEMONITOR_H
+
+#include <chrono>
+
+#include "G4UserEventAction.hh"
+#include "G4UserSteppingAction.hh"
+
+namespace G4UA
+{
+
+  /// @class StepRateMonitor
+  /// @brief Counts G4 steps and the wall time spent in G4 events, to
+  /// benchmark the stepping throughput (e.g. of different field services)
+  class StepRateMonitor : public G4UserEventAction,
+                          public G4UserSteppingAction
+  {
+
+  public:
+
+    /// Step and time counts, merged over the threads by the tool
+    struct Report
+    {
+      unsigned long long nEvents = 0;
+      unsigned long long nSteps = 0;
+      /// wall time between begin and end of event [s]
+      double eventTime = 0.;
+
+      void merge(const Report& rep);
+    };
+
+    /// @name user action interface
+    /// @{
+    virtual void BeginOfEventAction(const G4Event*) override final;
+    virtual void EndOfEventAction(const G4Event*) override final;
+    virtual void UserSteppingAction(const G4Step*) override final;
+    /// @}
+
+    const Report& getReport() const
+    { return m_report; }
+
+  private:
+
+    Report m_report;
+    std::chrono::steady_clock::time_point m_eventStart;
+
+  }; // class StepRateMonitor
+
+} // namespace G4UA
+
+#endif
@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "StepRateMonitorTool.h"
+
+namespace G4UA
+{
+
+  //---------------------------------------------------------------------------
+  StepRateMonitorTool::StepRateMonitorTool(const std::string& type,
+                                           const std::string& name,
+                                           const IInterface* parent)
+    : UserActionToolBase<StepRateMonitor>(type, name, parent)
+  {}
+
+  //---------------------------------------------------------------------------
+  StatusCode StepRateMonitorTool::finalize()
+  {
+    StepRateMonitor::Report report;
+    m_actions.accumulate(report, &StepRateMonitor::getReport,
+                         &StepRateMonitor::Report::merge);
+
+    ATH_MSG_INFO("nEvents          " << report.nEvents);
+    ATH_MSG_INFO("nSteps           " << report.nSteps);
+    ATH_MSG_INFO("event time [s]   " << report.eventTime);
+    if (report.eventTime > 0.) {
+      ATH_MSG_INFO("steps/s          " << report.nSteps / report.eventTime);
+    }
+    return StatusCode::SUCCESS;
+  }
+
+  //---------------------------------------------------------------------------
+  std::unique_ptr<StepRateMonitor>
+  StepRateMonitorTool::makeAndFillAction(G4AtlasUserActions& actionList)
+  {
+    ATH_MSG_DEBUG("Constructing a StepRateMonitor action");
+    auto action = std::make_unique<StepRateMonitor>();
+    actionList.eventActions.push_back( action.get() );
+    actionList.steppingActions.push_back( action.get() );
+    return action;
+  }
+
+} // namespace G4UA
@@ -0,0 +1,42 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef G4ATLASTESTS_G4UA__STEPRATEMONITORTOOL_H
+#define G4ATLASTESTS_G4UA__STEPRATEMONITORTOOL_H
+
+#include "G4AtlasTools/UserActionToolBase.h"
+#include "StepRateMonitor.h"
+
+namespace G4UA
+{
+
+  /// @class StepRateMonitorTool
+  /// @brief a tool to manage the StepRateMonitor action in AthenaMT
+  ///
+  /// creates one instance of the action per thread and prints the
+  /// number of steps per second of event time summed over all threads
+  ///
+  class StepRateMonitorTool : public UserActionToolBase<StepRateMonitor>
+  {
+
+  public:
+
+    /// standard tool ctor
+    StepRateMonitorTool(const std::string& type, const std::string& name,
+                        const IInterface* parent);
+
+    /// merge and print the counts of all threads
+    virtual StatusCode finalize() override final;
+
+  protected:
+
+    /// creates the instance of the action for this thread
+    virtual std::unique_ptr<StepRateMonitor>
+    makeAndFillAction(G4AtlasUserActions&) override final;
+
+  }; // class StepRateMonitorTool
+
+} // namespace G4UA
+
+#endif
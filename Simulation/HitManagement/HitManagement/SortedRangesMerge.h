@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef HITMANAGEMENT_SORTEDRANGESMERGE
+#define HITMANAGEMENT_SORTEDRANGESMERGE
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace HitManagement {
+
+  /// Stable sort of a vector made of consecutive ranges, e.g. the hits of the
+  /// sub-events inserted into a TimedHitCollection. @c rangeEnds holds the end
+  /// offset of each range. Every range is sorted on its own (G4 hit collections
+  /// are often in order already) and the ranges are then merged pairwise, which
+  /// gives the same order as std::stable_sort over the whole vector.
+  /// The merge buffer is local, so that no second copy of the hits is kept
+  /// after the sort. On return @c rangeEnds describes the single sorted range.
+  template <class T>
+  void sortRanges(std::vector<T>& v, std::vector<std::size_t>& rangeEnds) {
+    if (rangeEnds.empty() || rangeEnds.back() != v.size()) rangeEnds.push_back(v.size());
+
+    std::size_t begin(0);
+    for (std::size_t end : rangeEnds) {
+      if (!std::is_sorted(v.begin() + begin, v.begin() + end)) {
+        std::stable_sort(v.begin() + begin, v.begin() + end);
+      }
+      begin = end;
+    }
+    if (rangeEnds.size() < 2) return;
+
+    // bottom-up merge, alternating between v and scratch
+    std::vector<T> scratch(v.size());
+    std::vector<T>* src(&v);
+    std::vector<T>* dst(&scratch);
+    while (rangeEnds.size() > 1) {
+      std::size_t nMerged(0);
+      begin = 0;
+      for (std::size_t i(0); i < rangeEnds.size(); i += 2) {
+        const std::size_t middle(rangeEnds[i]);
+        const std::size_t end((i + 1 < rangeEnds.size()) ? rangeEnds[i + 1] : middle);
+        // std::merge takes equal elements from the first range first: stable
+        std::merge(src->begin() + begin, src->begin() + middle,
+                   src->begin() + middle, src->begin() + end,
+                   dst->begin() + begin);
+        rangeEnds[nMerged++] = end;
+        begin = end;
+      }
+      rangeEnds.resize(nMerged);
+      std::swap(src, dst);
+    }
+    if (src != &v) v.swap(scratch);
+  }
+
+}
+
+#endif
@@ -1,10 +1,11 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef HITMANAGEMENT_TIMEDHITCOLLECTION
 #define HITMANAGEMENT_TIMEDHITCOLLECTION
 
+#include <cstddef>
 #include <functional>
 #include <vector>
 #include "HitManagement/AtlasHitsVector.h"
@@ -56,6 +57,7 @@ private:
   TimedVector m_hits;
   const_iterator m_currentHit; ///< of current detector element;
   bool m_sorted; ///< flag the fact that the collection has been sorted
+  std::vector<std::size_t> m_rangeEnds; ///< end of the hits of each inserted collection in m_hits
 };
 
 #include "TimedHitCollection.icc"
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef HITMANAGEMENT_TIMEDHITPTR
@@ -10,6 +10,9 @@
  *  extended timing info of the host event. For a pu event this is
  *  taken from the event PileUpTimeEventIndex usually accessed via
  *  PileUpMergeSvc::TimedList
+ *
+ *  One TimedHitPtr is created for every signal and pile-up hit, so the
+ *  members are laid out to fit in 16 bytes.
  **/
 
 template <class HIT>
@@ -22,10 +25,10 @@ public:
 
   ///minimal constructor: pass only t0 offset of bunch xing
   TimedHitPtr(float eventTime, const HIT* pHit, int pileupType=0) :
-    m_eventTime(eventTime), m_eventId(0), m_pileupType(pileupType), m_pHit(pHit) {}
+    m_eventTime(eventTime), m_eventId(0), m_pileupType(static_cast<short>(pileupType)), m_pHit(pHit) {}
   ///use this constructor when hit has a PileUpTimeEventIndex
   TimedHitPtr(float eventTime, unsigned short eventId, const HIT* pHit, int pileupType=0) :
-    m_eventTime(eventTime), m_eventId(eventId), m_pileupType(pileupType), m_pHit(pHit) {}
+    m_eventTime(eventTime), m_eventId(eventId), m_pileupType(static_cast<short>(pileupType)), m_pHit(pHit) {}
 
   ///assignment operator
   TimedHitPtr<HIT>& operator=(const TimedHitPtr<HIT>& rhs) {
@@ -55,7 +58,8 @@ private:
   float m_eventTime;
   ///the index in PileUpEventInfo of the component event hosting this hit
   unsigned short m_eventId;
-  int m_pileupType;
+  ///PileUpTimeEventIndex::PileUpType, stored as short to keep the object small
+  short m_pileupType;
   const HIT* m_pHit; //don't own
 
   template <class FHIT>
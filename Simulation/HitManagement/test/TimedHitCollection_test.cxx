@@ -0,0 +1,156 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+/**
+ * @brief test the merge of sub-event hits in TimedHitCollection
+ * @author ATLAS Collaboration
+ */
+
+/* #define THBENCH 1 */
+#undef NDEBUG
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "HitManagement/TimedHitCollection.h"
+#include "HitManagement/AtlasHitsVector.h"
+
+struct TestHit {
+  TestHit() : t(0.0), id(0) {}
+  TestHit(float T, int I) : t(T), id(I) {}
+  float t;
+  int id;
+};
+float hitTime(const TestHit& h) { return h.t; }
+bool operator < (const TestHit& lhs, const TestHit& rhs) {
+  return (lhs.id < rhs.id);
+}
+
+#include "TestTools/initGaudi.h"
+using namespace Athena_test;
+
+using namespace std;
+
+namespace {
+  /// synthetic pile-up: nEvents sub-events, each with hits on random detector elements
+  std::vector<std::unique_ptr<AtlasHitsVector<TestHit> > >
+  makeSubEvents(unsigned int nEvents, unsigned int nHitsPerEvent, bool sortedInput) {
+    std::mt19937 engine(4357);
+    std::uniform_int_distribution<int> element(0, 20000);
+    std::vector<std::unique_ptr<AtlasHitsVector<TestHit> > > subEvents;
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent) {
+      auto hits = std::make_unique<AtlasHitsVector<TestHit> >("TestHits", nHitsPerEvent);
+      std::vector<int> ids(nHitsPerEvent);
+      for (int& id : ids) id = element(engine);
+      if (sortedInput) std::sort(ids.begin(), ids.end());
+      for (int id : ids) hits->Emplace(static_cast<float>(iEvent), id);
+      subEvents.push_back(std::move(hits));
+    }
+    return subEvents;
+  }
+
+  void testMerge(unsigned int nEvents, unsigned int nHitsPerEvent, bool sortedInput) {
+    auto subEvents = makeSubEvents(nEvents, nHitsPerEvent, sortedInput);
+
+    // reference: the previous implementation, one stable sort over all hits
+    auto start = std::chrono::steady_clock::now();
+    std::vector<TimedHitPtr<TestHit> > reference;
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent) {
+      for (const TestHit& hit : *subEvents[iEvent]) {
+        reference.push_back(TimedHitPtr<TestHit>(25.f * iEvent, iEvent, &hit));
+      }
+    }
+    std::stable_sort(reference.begin(), reference.end());
+    auto referenceTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    TimedHitCollection<TestHit> thc;
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent) {
+      thc.insert(PileUpTimeEventIndex(25 * iEvent, iEvent), subEvents[iEvent].get());
+    }
+    std::vector<TimedHitPtr<TestHit> > merged;
+    merged.reserve(reference.size());
+    TimedHitCollection<TestHit>::const_iterator i, e;
+    unsigned int nElements(0);
+    while (thc.nextDetectorElement(i, e)) {
+      ++nElements;
+      for (; i != e; ++i) merged.push_back(*i);
+    }
+    auto mergeTime = std::chrono::steady_clock::now() - start;
+
+    // same hits in the same order, also for hits on the same element
+    assert(merged.size() == reference.size());
+    for (size_t ihit = 0; ihit < merged.size(); ++ihit) {
+      assert(&(*merged[ihit]) == &(*reference[ihit]));
+      assert(merged[ihit].eventId() == reference[ihit].eventId());
+    }
+    assert(nElements > 0);
+#ifdef THBENCH
+    cout << nEvents << " sub-events, " << nHitsPerEvent << " hits each, "
+         << (sortedInput ? "sorted" : "unsorted") << " input: stable_sort "
+         << std::chrono::duration_cast<std::chrono::microseconds>(referenceTime).count()
+         << " us, merge " << std::chrono::duration_cast<std::chrono::microseconds>(mergeTime).count()
+         << " us" << endl;
+#else
+    (void)referenceTime;
+    (void)mergeTime;
+#endif
+  }
+
+  void testInsertAfterSort() {
+    AtlasHitsVector<TestHit> first("First", 3);
+    first.Emplace(1.f, 3);
+    first.Emplace(1.f, 1);
+    first.Emplace(1.f, 2);
+    AtlasHitsVector<TestHit> second("Second", 2);
+    second.Emplace(2.f, 2);
+    second.Emplace(2.f, 0);
+
+    TimedHitCollection<TestHit> thc;
+    thc.insert(0.f, &first);
+    TimedHitCollection<TestHit>::const_iterator i, e;
+    assert(thc.nextDetectorElement(i, e));
+    assert((*i)->id == 1);
+    bool thrown(false);
+    try {
+      thc.insert(0.f, &second);
+    } catch (const TimedHitCollection<TestHit>::SortedException&) {
+      thrown = true;
+    }
+    assert(thrown);
+    std::vector<int> ids;
+    std::vector<float> times;
+    while (thc.nextDetectorElement(i, e)) {
+      for (; i != e; ++i) {
+        ids.push_back((*i)->id);
+        times.push_back((*i)->t);
+      }
+    }
+    assert((ids == std::vector<int>{0, 1, 2, 2, 3}));
+    // hit of the first collection comes first on element 2
+    assert(times[2] == 1.f && times[3] == 2.f);
+  }
+}
+
+int main() {
+  cout << "*** TimedHitCollection_test starts ***" <<endl;
+  ISvcLocator* pSvcLoc;
+  if (!initGaudi(pSvcLoc)) {
+    cerr << "This test can not be run" << endl;
+    return 0;
+  }
+  assert(pSvcLoc);
+
+  testInsertAfterSort();
+  // mu=200 in-time pile-up
+  testMerge(200, 500, false);
+  testMerge(200, 500, true);
+  testMerge(1, 1000, false);
+
+  cout << "*** TimedHitCollection_test OK ***" <<endl;
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -33,6 +33,9 @@ bool operator < (const TestHit& lhs, const TestHit& rhs) {
 
 std::atomic<unsigned int> TestHit::HOWMANY=0;
 
+// one TimedHitPtr per pile-up hit: keep it at two words
+static_assert(sizeof(TimedHitPtr<TestHit>) == 16, "TimedHitPtr should fit in 16 bytes");
+
 
 #include "TestTools/initGaudi.h"
 using namespace Athena_test;
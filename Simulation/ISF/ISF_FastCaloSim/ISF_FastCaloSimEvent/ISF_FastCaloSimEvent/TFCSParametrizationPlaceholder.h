@@ -1,23 +1,90 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ISF_FASTCALOSIMEVENT_TFCSParametrizationPlaceholder_h
 #define ISF_FASTCALOSIMEVENT_TFCSParametrizationPlaceholder_h
 
 #include "ISF_FastCaloSimEvent/TFCSParametrizationBase.h"
+#include <atomic>
+#include <set>
+#include <string>
+
+class TDirectory;
 
 class TFCSParametrizationPlaceholder:public TFCSParametrizationBase {
 public:
   TFCSParametrizationPlaceholder(const char* name=nullptr, const char* title=nullptr):TFCSParametrizationBase(name,title) {};
+  virtual ~TFCSParametrizationPlaceholder();
+
+  ///Store the pdgid, Ekin and eta ranges of the real parametrization, such that the match methods
+  ///can be answered without loading it. Only done for parametrizations deriving from TFCSParametrization
+  void set_match(const TFCSParametrizationBase& ref);
+
+  ///The match methods use the ranges stored at writing time if available,
+  ///otherwise they are forwarded to the real parametrization, which is loaded if needed.
+  ///is_match_Ekin_bin and is_match_calosample are always forwarded
+  virtual bool is_match_pdgid(int id) const override;
+  virtual bool is_match_Ekin(float Ekin) const override;
+  virtual bool is_match_eta(float eta) const override;
+  virtual bool is_match_Ekin_bin(int Ekin_bin) const override;
+  virtual bool is_match_calosample(int calosample) const override;
+
+  virtual bool is_match_all_pdgid() const override;
+  virtual bool is_match_all_Ekin() const override;
+  virtual bool is_match_all_eta() const override;
+  virtual bool is_match_all_Ekin_bin() const override;
+  virtual bool is_match_all_calosample() const override;
+
+  virtual const std::set< int > &pdgid() const override;
+  virtual double Ekin_nominal() const override;
+  virtual double Ekin_min() const override;
+  virtual double Ekin_max() const override;
+  virtual double eta_nominal() const override;
+  virtual double eta_min() const override;
+  virtual double eta_max() const override;
 
-  virtual bool is_match_Ekin_bin(int /*Ekin_bin*/) const override {return true;};
-  virtual bool is_match_calosample(int /*calosample*/) const override {return true;};
+  ///Remember the geometry, it is passed on to the real parametrization once it is loaded
+  virtual void set_geometry(ICaloGeometry* geo) override;
+
+  ///If set, placeholders found while reading a split TFCSParametrizationChain are kept in the chain
+  ///and the real parametrization is read from the file at its first use.
+  ///Placeholders inside a parametrization read on demand are again read on demand.
+  ///The file has to stay open as long as the parametrization is used.
+  ///With compressMemory, RemoveDuplicates and RemoveNameTitle are applied to each loaded parametrization
+  static void set_LoadOnDemand(bool onDemand,bool compressMemory=false) {s_compressMemory=compressMemory;s_loadOnDemand=onDemand;};
+  static bool LoadOnDemand();
+
+  ///Directory from which the real parametrization is read on demand, under the current name of the placeholder
+  void set_directory(TDirectory* dir);
+
+  ///Real parametrization, read from the directory on the first call. Returns nullptr if it can't be read
+  const TFCSParametrizationBase* load() const;
+  bool is_loaded() const {return m_param.load()!=nullptr;};
 
   virtual FCSReturnCode simulate(TFCSSimulationState& simulstate,const TFCSTruthState* truth, const TFCSExtrapolationState* extrapol) const override;
 private:
+  bool m_hasMatch{false};
+  std::set< int > m_pdgid;
+  double m_Ekin_nominal{init_Ekin_nominal};
+  double m_Ekin_min{init_Ekin_min};
+  double m_Ekin_max{init_Ekin_max};
+  double m_eta_nominal{init_eta_nominal};
+  double m_eta_min{init_eta_min};
+  double m_eta_max{init_eta_max};
+  bool m_match_all_Ekin_bin{false};
+  bool m_match_all_calosample{false};
+
+  TDirectory* m_dir{nullptr};//! Do not persistify!
+  std::string m_key;//! Do not persistify!
+  bool m_compressMemory{false};//! Do not persistify!
+  ICaloGeometry* m_geo{nullptr};//! Do not persistify!
+  mutable std::atomic<TFCSParametrizationBase*> m_param{nullptr};//! Do not persistify!
+
+  static std::atomic<bool> s_loadOnDemand;//! Do not persistify!
+  static std::atomic<bool> s_compressMemory;//! Do not persistify!
 
-  ClassDefOverride(TFCSParametrizationPlaceholder,1)  //TFCSParametrizationPlaceholder
+  ClassDefOverride(TFCSParametrizationPlaceholder,2)  //TFCSParametrizationPlaceholder
 };
 
 #endif
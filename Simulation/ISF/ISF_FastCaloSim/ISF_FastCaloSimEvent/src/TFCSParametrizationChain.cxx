@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "ISF_FastCaloSimEvent/TFCSParametrizationChain.h"
@@ -216,6 +216,13 @@ void TFCSParametrizationChain::Streamer(TBuffer &R__b)
             if(R__t->InheritsFrom(TFCSParametrizationPlaceholder::Class())) {
               TFCSParametrizationBase* new_R__t=nullptr;
 
+              if(dir && TFCSParametrizationPlaceholder::LoadOnDemand()) {
+                //keep the placeholder, the real object is read at its first use
+                static_cast<TFCSParametrizationPlaceholder*>(R__t)->set_directory(dir);
+                R__stl.push_back(R__t);
+                continue;
+              }
+
               if(dir) new_R__t=(TFCSParametrizationBase*)dir->Get(R__t->GetName());
 
               if(new_R__t) {
@@ -255,7 +262,9 @@ void TFCSParametrizationChain::Streamer(TBuffer &R__b)
           TFCSParametrizationBase* new_R__t=nullptr;
           if(dir && R__t!=nullptr) {
             dir->WriteTObject(R__t);
-            new_R__t=new TFCSParametrizationPlaceholder(R__t->GetName(),TString("Placeholder for: ")+R__t->GetTitle());
+            TFCSParametrizationPlaceholder* placeholder=new TFCSParametrizationPlaceholder(R__t->GetName(),TString("Placeholder for: ")+R__t->GetTitle());
+            placeholder->set_match(*R__t);
+            new_R__t=placeholder;
             R__t=new_R__t;
           }
           R__b << R__t;
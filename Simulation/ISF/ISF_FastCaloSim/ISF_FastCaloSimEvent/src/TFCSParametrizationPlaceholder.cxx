@@ -1,16 +1,225 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "ISF_FastCaloSimEvent/TFCSParametrizationPlaceholder.h"
+#include "ISF_FastCaloSimEvent/TFCSParametrization.h"
+#include "TDirectory.h"
+#include <mutex>
+
+namespace {
+  /// Serializes reading from the parametrization file, shared by all placeholders
+  std::recursive_mutex loadMutex;
+  /// Placeholder whose parametrization is being read in this thread, if any
+  thread_local const TFCSParametrizationPlaceholder* loadingPlaceholder=nullptr;
+}
 
 //=============================================
 //======= TFCSParametrizationPlaceholder =========
 //=============================================
 
-FCSReturnCode TFCSParametrizationPlaceholder::simulate(TFCSSimulationState& /*simulstate*/,const TFCSTruthState* /*truth*/, const TFCSExtrapolationState* /*extrapol*/) const
+std::atomic<bool> TFCSParametrizationPlaceholder::s_loadOnDemand=false;
+std::atomic<bool> TFCSParametrizationPlaceholder::s_compressMemory=false;
+
+TFCSParametrizationPlaceholder::~TFCSParametrizationPlaceholder()
+{
+  delete m_param.load();
+}
+
+bool TFCSParametrizationPlaceholder::LoadOnDemand()
+{
+  return s_loadOnDemand || loadingPlaceholder;
+}
+
+void TFCSParametrizationPlaceholder::set_directory(TDirectory* dir)
+{
+  m_dir=dir;
+  m_key=GetName();
+  m_compressMemory=loadingPlaceholder ? loadingPlaceholder->m_compressMemory : s_compressMemory.load();
+}
+
+void TFCSParametrizationPlaceholder::set_match(const TFCSParametrizationBase& ref)
+{
+  m_hasMatch=ref.InheritsFrom(TFCSParametrization::Class());
+  if(!m_hasMatch) return;
+
+  if(ref.is_match_all_pdgid()) set_match_all_pdgid();
+  else reset_match_all_pdgid();
+  m_pdgid=ref.pdgid();
+  m_Ekin_nominal=ref.Ekin_nominal();
+  m_Ekin_min=ref.Ekin_min();
+  m_Ekin_max=ref.Ekin_max();
+  m_eta_nominal=ref.eta_nominal();
+  m_eta_min=ref.eta_min();
+  m_eta_max=ref.eta_max();
+  m_match_all_Ekin_bin=ref.is_match_all_Ekin_bin();
+  m_match_all_calosample=ref.is_match_all_calosample();
+}
+
+void TFCSParametrizationPlaceholder::set_geometry(ICaloGeometry* geo)
+{
+  std::lock_guard<std::recursive_mutex> lock(loadMutex);
+  m_geo=geo;
+  TFCSParametrizationBase* param=m_param.load(std::memory_order_relaxed);
+  if(param) param->set_geometry(geo);
+}
+
+const TFCSParametrizationBase* TFCSParametrizationPlaceholder::load() const
+{
+  TFCSParametrizationBase* param=m_param.load(std::memory_order_acquire);
+  if(param || !m_dir) return param;
+
+  std::lock_guard<std::recursive_mutex> lock(loadMutex);
+  param=m_param.load(std::memory_order_relaxed);
+  if(!param) {
+    //Placeholders in the object read here are kept and read on demand as well
+    const TFCSParametrizationPlaceholder* outer=loadingPlaceholder;
+    loadingPlaceholder=this;
+    param=dynamic_cast<TFCSParametrizationBase*>(m_dir->Get(m_key.c_str()));
+    loadingPlaceholder=outer;
+    if(!param) {
+      ATH_MSG_ERROR("TFCSParametrizationPlaceholder::load(): could not read "<<m_key<<" from "<<m_dir->GetName());
+      return nullptr;
+    }
+    ATH_MSG_DEBUG("TFCSParametrizationPlaceholder::load(): read "<<m_key<<" from "<<m_dir->GetName());
+    //Same treatment as applied by FastCaloSimV2ParamSvc to a fully read parametrization
+    if(m_compressMemory) param->RemoveDuplicates();
+    if(m_geo) param->set_geometry(m_geo);
+#if defined(__FastCaloSimStandAlone__)
+    param->setLevel(level(),true);
+#endif
+    if(m_compressMemory) {
+      param->SetName("");
+      param->SetTitle("");
+      param->RemoveNameTitle();
+    }
+    m_param.store(param,std::memory_order_release);
+  }
+  return param;
+}
+
+bool TFCSParametrizationPlaceholder::is_match_pdgid(int id) const
+{
+  if(m_hasMatch) return TestBit(kMatchAllPDGID) || m_pdgid.find(id)!=m_pdgid.end();
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_pdgid(id) : TFCSParametrizationBase::is_match_pdgid(id);
+}
+
+bool TFCSParametrizationPlaceholder::is_match_Ekin(float Ekin) const
+{
+  if(m_hasMatch) return (Ekin>=m_Ekin_min) && (Ekin<m_Ekin_max);
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_Ekin(Ekin) : TFCSParametrizationBase::is_match_Ekin(Ekin);
+}
+
+bool TFCSParametrizationPlaceholder::is_match_eta(float eta) const
+{
+  if(m_hasMatch) return (eta>=m_eta_min) && (eta<m_eta_max);
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_eta(eta) : TFCSParametrizationBase::is_match_eta(eta);
+}
+
+bool TFCSParametrizationPlaceholder::is_match_Ekin_bin(int Ekin_bin) const
+{
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_Ekin_bin(Ekin_bin) : true;
+}
+
+bool TFCSParametrizationPlaceholder::is_match_calosample(int calosample) const
+{
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_calosample(calosample) : true;
+}
+
+bool TFCSParametrizationPlaceholder::is_match_all_pdgid() const
 {
+  if(m_hasMatch) return TestBit(kMatchAllPDGID);
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_all_pdgid() : TFCSParametrizationBase::is_match_all_pdgid();
+}
+
+bool TFCSParametrizationPlaceholder::is_match_all_Ekin() const
+{
+  if(m_hasMatch) return m_Ekin_min==init_Ekin_min && m_Ekin_max==init_Ekin_max;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_all_Ekin() : TFCSParametrizationBase::is_match_all_Ekin();
+}
+
+bool TFCSParametrizationPlaceholder::is_match_all_eta() const
+{
+  if(m_hasMatch) return m_eta_min==init_eta_min && m_eta_max==init_eta_max;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_all_eta() : TFCSParametrizationBase::is_match_all_eta();
+}
+
+bool TFCSParametrizationPlaceholder::is_match_all_Ekin_bin() const
+{
+  if(m_hasMatch) return m_match_all_Ekin_bin;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_all_Ekin_bin() : TFCSParametrizationBase::is_match_all_Ekin_bin();
+}
+
+bool TFCSParametrizationPlaceholder::is_match_all_calosample() const
+{
+  if(m_hasMatch) return m_match_all_calosample;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->is_match_all_calosample() : TFCSParametrizationBase::is_match_all_calosample();
+}
+
+const std::set< int > &TFCSParametrizationPlaceholder::pdgid() const
+{
+  if(m_hasMatch) return m_pdgid;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->pdgid() : TFCSParametrizationBase::pdgid();
+}
+
+double TFCSParametrizationPlaceholder::Ekin_nominal() const
+{
+  if(m_hasMatch) return m_Ekin_nominal;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->Ekin_nominal() : TFCSParametrizationBase::Ekin_nominal();
+}
+
+double TFCSParametrizationPlaceholder::Ekin_min() const
+{
+  if(m_hasMatch) return m_Ekin_min;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->Ekin_min() : TFCSParametrizationBase::Ekin_min();
+}
+
+double TFCSParametrizationPlaceholder::Ekin_max() const
+{
+  if(m_hasMatch) return m_Ekin_max;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->Ekin_max() : TFCSParametrizationBase::Ekin_max();
+}
+
+double TFCSParametrizationPlaceholder::eta_nominal() const
+{
+  if(m_hasMatch) return m_eta_nominal;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->eta_nominal() : TFCSParametrizationBase::eta_nominal();
+}
+
+double TFCSParametrizationPlaceholder::eta_min() const
+{
+  if(m_hasMatch) return m_eta_min;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->eta_min() : TFCSParametrizationBase::eta_min();
+}
+
+double TFCSParametrizationPlaceholder::eta_max() const
+{
+  if(m_hasMatch) return m_eta_max;
+  const TFCSParametrizationBase* param=load();
+  return param ? param->eta_max() : TFCSParametrizationBase::eta_max();
+}
+
+FCSReturnCode TFCSParametrizationPlaceholder::simulate(TFCSSimulationState& simulstate,const TFCSTruthState* truth, const TFCSExtrapolationState* extrapol) const
+{
+  const TFCSParametrizationBase* param=load();
+  if(param) return param->simulate(simulstate,truth,extrapol);
+
   ATH_MSG_ERROR("TFCSParametrizationPlaceholder::simulate(). This is a placeholder and should never get called. Likely a problem in the reading of the parametrization file occured and this class was not replaced with the real parametrization");
   return FCSFatal;
 }
-
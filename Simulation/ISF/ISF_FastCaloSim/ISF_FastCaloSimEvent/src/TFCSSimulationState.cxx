@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "CLHEP/Random/RandomEngine.h"
@@ -33,11 +33,6 @@ void TFCSSimulationState::clear()
 
 void TFCSSimulationState::deposit(const CaloDetDescrElement* cellele, float E)
 {
-  auto mele=m_cells.find(cellele);
-  if(mele==m_cells.end()) {
-    m_cells.emplace(cellele,0);
-    mele=m_cells.find(cellele);
-  }  
   m_cells[cellele]+=E;
 }
 
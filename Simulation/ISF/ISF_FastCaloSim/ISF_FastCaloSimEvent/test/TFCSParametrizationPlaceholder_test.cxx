@@ -0,0 +1,128 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+// Reads a parametrization with split chain objects once fully and once with
+// TFCSParametrizationPlaceholder::LoadOnDemand, and compares the simulation.
+// Checks that placeholders, also those inside a nested split chain, are only
+// loaded once they are simulated.
+
+#undef NDEBUG
+#include "ISF_FastCaloSimEvent/TFCSParametrizationPDGIDSelectChain.h"
+#include "ISF_FastCaloSimEvent/TFCSParametrizationChain.h"
+#include "ISF_FastCaloSimEvent/TFCSParametrizationPlaceholder.h"
+#include "ISF_FastCaloSimEvent/TFCSEnergyInterpolationLinear.h"
+#include "ISF_FastCaloSimEvent/TFCSSimulationState.h"
+#include "ISF_FastCaloSimEvent/TFCSTruthState.h"
+#include "ISF_FastCaloSimEvent/TFCSExtrapolationState.h"
+#include "TFile.h"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+  const char* fileName="TFCSParametrizationPlaceholder_test.root";
+
+  void writeParametrization()
+  {
+    TFCSParametrizationPDGIDSelectChain chain("SelPDGID","select pdgid");
+    chain.set_SplitChainObjects();
+
+    TFCSEnergyInterpolationLinear* photon=new TFCSEnergyInterpolationLinear("photon","photon");
+    photon->set_pdgid(22);
+    photon->set_slope(0.9);
+    photon->set_offset(10);
+    chain.push_back(photon);
+
+    TFCSParametrizationChain* electronChain=new TFCSParametrizationChain("electronChain","electron chain");
+    electronChain->set_SplitChainObjects();
+    TFCSEnergyInterpolationLinear* electron=new TFCSEnergyInterpolationLinear("electron","electron");
+    electron->set_pdgid(11);
+    electron->set_slope(0.8);
+    electron->set_offset(-20);
+    electronChain->push_back(electron);
+    chain.push_back(electronChain);
+
+    std::unique_ptr<TFile> file(TFile::Open(fileName,"RECREATE"));
+    file->WriteTObject(&chain,"param");
+    file->Close();
+    TFCSParametrizationBase::DoCleanup();
+
+    delete photon;
+    delete electronChain;
+    delete electron;
+  }
+
+  std::vector<double> simulate(const TFCSParametrizationBase& param,const std::vector<int>& pdgids)
+  {
+    std::vector<double> energies;
+    TFCSExtrapolationState extrapol;
+    for(int pdgid : pdgids) {
+      for(double Ekin : {1000., 20000., 500000.}) {
+        TFCSTruthState truth;
+        truth.SetPxPyPzE(Ekin,0,0,Ekin);
+        truth.set_pdgid(pdgid);
+        TFCSSimulationState simulstate;
+        assert(param.simulate(simulstate,&truth,&extrapol)==FCSSuccess);
+        energies.push_back(simulstate.E());
+      }
+    }
+    return energies;
+  }
+
+  const TFCSParametrizationPlaceholder* placeholder(const TFCSParametrizationBase* param)
+  {
+    assert(param && param->InheritsFrom(TFCSParametrizationPlaceholder::Class()));
+    return static_cast<const TFCSParametrizationPlaceholder*>(param);
+  }
+}
+
+int main()
+{
+  writeParametrization();
+
+  std::unique_ptr<TFile> file(TFile::Open(fileName,"READ"));
+
+  // Full reading: the placeholders are replaced by the real objects
+  std::unique_ptr<TFCSParametrizationBase> eager(static_cast<TFCSParametrizationBase*>(file->Get("param")));
+  assert(eager && eager->size()==2);
+  assert(!(*eager)[0]->InheritsFrom(TFCSParametrizationPlaceholder::Class()));
+
+  // Reading on demand: the placeholders stay in the chain until used
+  TFCSParametrizationPlaceholder::set_LoadOnDemand(true,true);
+  std::unique_ptr<TFCSParametrizationBase> onDemand(static_cast<TFCSParametrizationBase*>(file->Get("param")));
+  TFCSParametrizationPlaceholder::set_LoadOnDemand(false);
+  assert(onDemand && onDemand->size()==2);
+  const TFCSParametrizationPlaceholder* photon=placeholder((*onDemand)[0]);
+  const TFCSParametrizationPlaceholder* electronChain=placeholder((*onDemand)[1]);
+
+  // Placeholders give the match properties of the real objects without loading them
+  onDemand->Print();
+  onDemand->RemoveNameTitle();
+  assert(photon->is_match_pdgid(22) && !photon->is_match_pdgid(11));
+  assert(electronChain->is_match_pdgid(11) && !electronChain->is_match_pdgid(22));
+  assert(electronChain->pdgid()==(*eager)[1]->pdgid());
+  assert(electronChain->is_match_all_Ekin()==(*eager)[1]->is_match_all_Ekin());
+  assert(!photon->is_loaded() && !electronChain->is_loaded());
+
+  // Only the photon is loaded by simulating photons
+  const std::vector<double> eagerPhotonE=simulate(*eager,{22});
+  assert(simulate(*onDemand,{22})==eagerPhotonE);
+  assert(photon->is_loaded() && !electronChain->is_loaded());
+
+  // The nested chain is read on demand as well
+  const TFCSParametrizationBase* electronChainParam=electronChain->load();
+  assert(electronChainParam && electronChainParam->size()==1);
+  assert(!placeholder((*electronChainParam)[0])->is_loaded());
+
+  const std::vector<double> eagerE=simulate(*eager,{22, 11, 211});
+  const std::vector<double> onDemandE=simulate(*onDemand,{22, 11, 211});
+  assert(eagerE==onDemandE);
+  assert(placeholder((*electronChainParam)[0])->is_loaded());
+  // Check that energy was deposited at all
+  assert(eagerE[0]>0 && eagerE[3]>0);
+
+  std::cout<<"TFCSParametrizationPlaceholder_test: "<<eagerE.size()<<" simulations agree"<<std::endl;
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ISF_FASTCALOSIMPARAMETRIZATION_CALOGEOMETRY_H
@@ -96,11 +96,19 @@ class CaloGeometry : virtual public ICaloGeometry {
 
     virtual void InitRZmaps();
 
+    ///Fill for each sampling the list of lookup regions overlapping each eta bin of width m_region_index_deta
+    virtual void InitRegionIndex();
+
     t_cellmap m_cells;
     std::vector< t_cellmap > m_cells_in_sampling;
     std::vector< t_eta_cellmap > m_cells_in_sampling_for_phi0;
     std::vector< std::vector< CaloGeometryLookup* > > m_cells_in_regions;
 
+    ///Candidate regions for getDDE(), [calosample][eta bin] -> indices into m_cells_in_regions[calosample]
+    std::vector< std::vector< std::vector< unsigned int > > > m_regions_in_etabin;
+    std::vector< double > m_region_index_mineta; //[calosample]
+    static const double m_region_index_deta;
+
     std::vector< bool > m_isCaloBarrel;
     std::vector< double > m_min_eta_sample[2]; //[side][calosample]
     std::vector< double > m_max_eta_sample[2]; //[side][calosample]
@@ -92,6 +92,25 @@ StatusCode FastCaloSimCaloExtrapolation::initialize()
       ATH_MSG_INFO("Extrapolator retrieved "<< m_extrapolator);
   }
 
+  // Cache the barrel cylinder half-lengths used in extrapolateToLayers
+  for(int sample=CaloCell_ID_FCS::FirstSample; sample<CaloCell_ID_FCS::MaxSample; ++sample){
+    if(!isCaloBarrel(sample)) continue;
+    for(int subpos=SUBPOS_MID; subpos<=SUBPOS_EXT; ++subpos){
+      //EMB0 - EMB3 use z position of EME1 front end surface for extrapolation
+      //else extrapolate to cylinder with symmetrized maximum Z bounds
+      //set eta to a dummy value of 1000 and -1000 to force detector side
+      if(sample < 4){
+        m_barrelCylZ[sample][subpos][0] = std::abs(zpos(5, -1000, 1));
+        m_barrelCylZ[sample][subpos][1] = std::abs(zpos(5, 1000, 1));
+      }
+      else{
+        const float cylZ = 0.5*(std::abs(zpos(sample, 1000, subpos)) + std::abs(zpos(sample, -1000, subpos)));
+        m_barrelCylZ[sample][subpos][0] = cylZ;
+        m_barrelCylZ[sample][subpos][1] = cylZ;
+      }
+    }
+  }
+
   ATH_MSG_INFO("m_CaloBoundaryR="<<m_CaloBoundaryR<<" m_CaloBoundaryZ="<<m_CaloBoundaryZ<<" m_caloEntranceName "<<m_caloEntranceName);
 
   return StatusCode::SUCCESS;
@@ -477,11 +496,8 @@ void FastCaloSimCaloExtrapolation::extrapolateToLayers(TFCSExtrapolationState& r
             float cylR, cylZ;
             if(isCaloBarrel(sample)){
               cylR = std::abs(rpos(sample, result.CaloSurface_eta(), subpos));
-              //EMB0 - EMB3 use z position of EME1 front end surface for extrapolation
-              //else extrapolate to cylinder with symmetrized maximum Z bounds
-              //set eta to a dummy value of 1000 and -1000 to force detector side
-              if(sample < 4) cylZ = result.CaloSurface_eta() > 0 ? std::abs(zpos(5, 1000, 1)) : std::abs(zpos(5, -1000, 1));
-              else cylZ = 0.5*(std::abs(zpos(sample, 1000, subpos)) + std::abs(zpos(sample, -1000, subpos)));
+              //cylinder half-length cached in initialize()
+              cylZ = m_barrelCylZ[sample][subpos][result.CaloSurface_eta() > 0 ? 1 : 0];
             }
             else{
               //if we are not at barrel surface, extrapolate to cylinder with maximum R to reduce extrapolation length
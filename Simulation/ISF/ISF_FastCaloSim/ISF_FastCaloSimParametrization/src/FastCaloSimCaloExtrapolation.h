@@ -11,6 +11,8 @@
 #include "TrkExInterfaces/ITimedExtrapolator.h"
 #include "TrkEventPrimitives/PdgToParticleHypothesis.h"
 
+#include <array>
+
 class IFastCaloSimGeometryHelper;
 class ITimedExtrapolator;
 class TFCSTruthState;
@@ -135,6 +137,10 @@ protected:
 
   std::vector<int> m_surfacelist;
 
+  ///Half-length of the cylinders used for the barrel layers, [sample][subpos][side], side 1 for eta>0.
+  ///These do not depend on the particle and are cached in initialize()
+  std::array<std::array<std::array<float, 2>, 3>, CaloCell_ID_FCS::MaxSample> m_barrelCylZ{};
+
   ToolHandle<Trk::ITimedExtrapolator>    m_extrapolator;
   mutable const Trk::TrackingVolume*     m_caloEntrance{nullptr};
   std::string                            m_caloEntranceName{""};
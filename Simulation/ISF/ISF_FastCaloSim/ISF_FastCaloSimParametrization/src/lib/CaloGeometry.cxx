@@ -35,10 +35,12 @@ int CaloGeometry_calocol[24]={1,2,3,4, // LAr barrel
 
 const int CaloGeometry::MAX_SAMPLING = CaloCell_ID_FCS::MaxSample; //number of calorimeter layers/samplings
 
+const double CaloGeometry::m_region_index_deta = 0.05; //eta bin width of the region index
+
 Identifier CaloGeometry::m_debug_identify;
 bool CaloGeometry::m_debug=false;
 
-CaloGeometry::CaloGeometry() : m_cells_in_sampling(MAX_SAMPLING),m_cells_in_sampling_for_phi0(MAX_SAMPLING),m_cells_in_regions(MAX_SAMPLING),m_isCaloBarrel(MAX_SAMPLING),m_dographs(false),m_FCal_ChannelMap(0)
+CaloGeometry::CaloGeometry() : m_cells_in_sampling(MAX_SAMPLING),m_cells_in_sampling_for_phi0(MAX_SAMPLING),m_cells_in_regions(MAX_SAMPLING),m_regions_in_etabin(MAX_SAMPLING),m_region_index_mineta(MAX_SAMPLING,0),m_isCaloBarrel(MAX_SAMPLING),m_dographs(false),m_FCal_ChannelMap(0)
 {
   //TMVA::Tools::Instance();
   for(int i=0;i<2;++i) {
@@ -492,8 +494,18 @@ const CaloDetDescrElement* CaloGeometry::getDDE(int sampling,float eta,float phi
    else beststeps=0;
   
   if(sampling<21) {
+    //regions that can contain eta from the precomputed index; if none of them has a match,
+    //fall back to the search of all regions without range check
+    const std::vector< unsigned int >* candidates=nullptr;
+    const std::vector< std::vector< unsigned int > >& etabins=m_regions_in_etabin[sampling];
+    if(!etabins.empty()) {
+      int ibin=TMath::FloorNint((eta-m_region_index_mineta[sampling])/m_region_index_deta);
+      if(ibin>=0 && ibin<(int)etabins.size()) candidates=&etabins[ibin];
+    }
     for(int skip_range_check=0;skip_range_check<=1;++skip_range_check) {
-      for(unsigned int j=0;j<m_cells_in_regions[sampling].size();++j) {
+      const unsigned int nregions=(!skip_range_check && candidates) ? candidates->size() : m_cells_in_regions[sampling].size();
+      for(unsigned int k=0;k<nregions;++k) {
+        const unsigned int j=(!skip_range_check && candidates) ? (*candidates)[k] : k;
         if(!skip_range_check) {
           if(eta<m_cells_in_regions[sampling][j]->mineta()) continue;
           if(eta>m_cells_in_regions[sampling][j]->maxeta()) continue;
@@ -635,6 +647,7 @@ bool CaloGeometry::PostProcessGeometry()
   }
   
   InitRZmaps(); 
+  InitRegionIndex();
   
   /*
   cout<<"all : "<<m_cells.size()<<endl;
@@ -652,6 +665,36 @@ bool CaloGeometry::PostProcessGeometry()
   return true;
 }
 
+void CaloGeometry::InitRegionIndex()
+{
+  for(int sampling=0;sampling<MAX_SAMPLING;++sampling) {
+    m_regions_in_etabin[sampling].clear();
+    m_region_index_mineta[sampling]=0;
+    const std::vector< CaloGeometryLookup* >& regions=m_cells_in_regions[sampling];
+    //FCal cells are found with getFCalDDE()
+    if(sampling>=21 || regions.empty()) continue;
+
+    double mineta=+10000;
+    double maxeta=-10000;
+    for(const CaloGeometryLookup* region : regions) {
+      mineta=TMath::Min(mineta,(double)region->mineta());
+      maxeta=TMath::Max(maxeta,(double)region->maxeta());
+    }
+    const int nbins=TMath::Max(1,TMath::CeilNint((maxeta-mineta)/m_region_index_deta));
+    m_region_index_mineta[sampling]=mineta;
+    m_regions_in_etabin[sampling].resize(nbins);
+
+    //regions are stored in increasing index order, such that getDDE() checks them in the same order as the full loop
+    for(unsigned int j=0;j<regions.size();++j) {
+      int first=TMath::FloorNint((regions[j]->mineta()-mineta)/m_region_index_deta);
+      int last =TMath::FloorNint((regions[j]->maxeta()-mineta)/m_region_index_deta);
+      first=TMath::Max(first,0);
+      last =TMath::Min(last,nbins-1);
+      for(int ibin=first;ibin<=last;++ibin) m_regions_in_etabin[sampling][ibin].push_back(j);
+    }
+  }
+}
+
 void CaloGeometry::Validate(int nrnd)
 {
   int ntest=0;
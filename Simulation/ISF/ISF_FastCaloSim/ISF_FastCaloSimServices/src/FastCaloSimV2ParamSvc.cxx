@@ -8,6 +8,7 @@
 
 // FastCaloSim includes
 #include "ISF_FastCaloSimEvent/TFCSParametrizationBase.h"
+#include "ISF_FastCaloSimEvent/TFCSParametrizationPlaceholder.h"
 #include "ISF_FastCaloSimEvent/TFCSSimulationState.h"
 #include "ISF_FastCaloSimEvent/TFCSTruthState.h"
 #include "ISF_FastCaloSimEvent/TFCSExtrapolationState.h"
@@ -53,6 +54,8 @@ ISF::FastCaloSimV2ParamSvc::FastCaloSimV2ParamSvc(const std::string& name, ISvcL
   declareProperty("PrintParametrization"           ,       m_printParametrization);
   declareProperty("CompressMemory"                 ,       m_CompressMemory);
   declareProperty("RunOnGPU"                       ,       m_runOnGPU);
+  declareProperty("LoadOnDemand"                   ,       m_loadOnDemand,
+                  "Read the objects of split parametrization chains from the file at their first use");
 }
 
 /** framework methods */
@@ -78,13 +81,25 @@ StatusCode ISF::FastCaloSimV2ParamSvc::initialize()
   }
   ATH_MSG_INFO("Opened parametrization file = "<<m_paramsFilename);
   paramsFile->ls();
+  if(m_loadOnDemand && m_runOnGPU) {
+    ATH_MSG_WARNING("LoadOnDemand is not supported together with RunOnGPU, reading the full parametrization");
+    m_loadOnDemand=false;
+  }
+  TFCSParametrizationPlaceholder::set_LoadOnDemand(m_loadOnDemand,m_CompressMemory);
   m_param=static_cast<TFCSParametrizationBase*>(paramsFile->Get(m_paramsObject.c_str()));
+  TFCSParametrizationPlaceholder::set_LoadOnDemand(false);
   if (!m_param) {
     ATH_MSG_WARNING("file = "<<m_paramsFilename<< ", object "<< m_paramsObject<<" not found");
     return StatusCode::FAILURE;
   }
 
-  paramsFile->Close();
+  if(m_loadOnDemand) {
+    // placeholders in the parametrization read from the file when first used
+    ATH_MSG_INFO("Parametrization objects are read on demand, keeping "<<m_paramsFilename<<" open");
+    m_paramsFile=std::move(paramsFile);
+  } else {
+    paramsFile->Close();
+  }
 
   if(m_CompressMemory) m_param->RemoveDuplicates();
   m_param->set_geometry(m_caloGeo.get()); /// does not take ownership
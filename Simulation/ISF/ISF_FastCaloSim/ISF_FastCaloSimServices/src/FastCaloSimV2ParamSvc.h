@@ -10,6 +10,8 @@
 #include "StoreGate/StoreGateSvc.h"
 #include "GaudiKernel/ServiceHandle.h"
 #include "ISF_FastCaloSimParametrization/CaloGeometryFromCaloDDM.h"
+#include "TFile.h"
+#include <memory>
 #ifdef USE_GPU
 #include "ISF_FastCaloGpu/GeoLoadGpu.h"
 #endif
@@ -63,6 +65,9 @@ namespace ISF {
     bool m_printParametrization{false};
     bool m_CompressMemory{true};
     bool m_runOnGPU{false};
+    bool m_loadOnDemand{false};
+    /// parametrization file, kept open if objects are read on demand
+    std::unique_ptr<TFile> m_paramsFile{};
   };
 
 }
@@ -48,6 +48,7 @@
 #include "CxxUtils/checker_macros.h"
 
 
+#include <array>
 #include <map>
 #include <vector>
 #include <string>
@@ -88,6 +89,30 @@ struct ContainerForCollection<TileRawChannelCollection>
 };
 
 
+// Helper to find which kind of objects decoded from the ROD fragments
+// are kept in a collection (bit mask, see TileROD_Decoder::FragOutput).
+template <class COLLECTION>
+struct OutputForCollection {};
+
+template <>
+struct OutputForCollection<TileBeamElemCollection>
+{
+  static constexpr uint8_t mask = 0;
+};
+
+template <>
+struct OutputForCollection<TileDigitsCollection>
+{
+  static constexpr uint8_t mask = 0x1;
+};
+
+template <>
+struct OutputForCollection<TileRawChannelCollection>
+{
+  static constexpr uint8_t mask = 0x2;
+};
+
+
 } // namespace TileROD_Helper
 
 
@@ -207,14 +232,19 @@ class TileROD_Decoder: public AthAlgTool {
       return m_hid2re;
     }
 
-    void setUseFrag0 (bool f) { m_useFrag0 = f; }
-    void setUseFrag1 (bool f) { m_useFrag1 = f; }
-    void setUseFrag4 (bool f) { m_useFrag4 = f; }
-    void setUseFrag5Raw (bool f) { m_useFrag5Raw = f; }
-    void setUseFrag5Reco (bool f) { m_useFrag5Reco = f; }
+    void setUseFrag0 (bool f) { m_useFrag0 = f; initFragTypeTable(); }
+    void setUseFrag1 (bool f) { m_useFrag1 = f; initFragTypeTable(); }
+    void setUseFrag4 (bool f) { m_useFrag4 = f; initFragTypeTable(); }
+    void setUseFrag5Raw (bool f) { m_useFrag5Raw = f; initFragTypeTable(); }
+    void setUseFrag5Reco (bool f) { m_useFrag5Reco = f; initFragTypeTable(); }
+    void setUseFragTypeDispatch (bool f) { m_useFragTypeDispatch = f; }
 
   enum TileFragStatus {ALL_OK=0, CRC_ERR=1, ALL_FF=0x10, ALL_00=0x20, NO_FRAG=0x40, NO_ROB=0x80};
 
+  /** bits used in the fragment type dispatch table to mark
+      which output a given subfragment type can contribute to */
+  enum FragOutput {DIGITS_OUTPUT=0x1, RAWCHANNEL_OUTPUT=0x2, ANY_OUTPUT=0xFF};
+
   private:
     friend class TileHid2RESrcID;
 
@@ -485,6 +515,18 @@ class TileROD_Decoder: public AthAlgTool {
      */
     bool checkBit(const uint32_t* p, int chan) const;
 
+    /** fill the fragment type dispatch table from the useFrag* properties
+     */
+    void initFragTypeTable();
+
+    /** check if subfragment of given type should be unpacked for the requested output
+     */
+    bool useFragType(uint32_t idAndType, uint8_t output) const;
+
+    /** switch off demonstrator channel remapping if frag4 header indicates simulated data
+     */
+    void checkDemoFragIDsMC(uint32_t idAndType) const;
+
     TileRawChannel2Bytes5 m_rc2bytes5;
     TileRawChannel2Bytes4 m_rc2bytes4;
     TileRawChannel2Bytes2 m_rc2bytes2;
@@ -499,6 +541,8 @@ class TileROD_Decoder: public AthAlgTool {
     Gaudi::Property<bool> m_useFrag5Raw{this, "useFrag5Raw", false, "Use frag5 raw"};
     Gaudi::Property<bool> m_useFrag5Reco{this, "useFrag5Reco", false, "Use frag5 reco"};
     Gaudi::Property<bool> m_ignoreFrag4HLT{this, "ignoreFrag4HLT", false, "Ignore frag4 HLT"};
+    Gaudi::Property<bool> m_useFragTypeDispatch{this, "useFragTypeDispatch", false,
+        "Unpack only subfragment types which contribute to the requested collection"};
 
     // Outside this time withdow, all amplitudes taken from Reco fragment will be set to zero
     Gaudi::Property<float> m_allowedTimeMin{this, "AllowedTimeMin", -50.0,
@@ -558,6 +602,9 @@ class TileROD_Decoder: public AthAlgTool {
     // Mutex protecting access to m_hid2re.
     mutable std::mutex m_HidMutex;
 
+    // Bit mask of FragOutput values for every subfragment type (0x00 - 0xFF)
+    std::array<uint8_t, 256> m_fragTypeOutput{};
+
     // fast decoding
     std::vector<int> m_Rw2Cell[4];
     std::vector<int> m_Rw2Pmt[4];
@@ -677,11 +724,24 @@ template<typename ELEMENT, class COLLECTION>
 inline void TileROD_Decoder::copy_vec(std::vector<ELEMENT *> & v, COLLECTION & coll) const {
   typedef typename std::vector<ELEMENT *>::const_iterator ELEMENT_const_iterator;
 
+  coll.reserve(coll.size() + v.size());
   ELEMENT_const_iterator iCh = v.begin();
   ELEMENT_const_iterator iEnd = v.end();
   for (; iCh != iEnd; ++iCh) coll.push_back(*iCh);
 }
 
+inline bool TileROD_Decoder::useFragType(uint32_t idAndType, uint8_t output) const {
+  return (m_fragTypeOutput[(idAndType & 0x00FF0000) >> 16] & output) != 0;
+}
+
+inline void TileROD_Decoder::checkDemoFragIDsMC(uint32_t idAndType) const {
+  int DataType = (idAndType & 0x30000000) >> 28;
+  if (DataType == 3 && !m_demoFragIDs.empty()) { // simulated data
+    const_cast<Gaudi::Property<std::vector<int>> &> ( m_demoFragIDs ) = {}; // No demonstator cabling in MC
+    ATH_MSG_INFO("Disable channel remapping for demonstrator in MC");
+  }
+}
+
 inline
 void TileROD_Decoder::make_copy(uint32_t /*bsflags*/,
                                 TileFragHash::TYPE /*rChType*/,
@@ -990,7 +1050,16 @@ void TileROD_Decoder::fillCollection(const ROBData * rob,
       continue;
     }
 
-    if (type != 0x10 && frag == frag_id) pFrag.push_back(p);
+    if (type != 0x10 && frag == frag_id) {
+      if (!m_useFragTypeDispatch || isBeamROD) {
+        pFrag.push_back(p);
+      } else if (useFragType(idAndType, TileROD_Helper::OutputForCollection<COLLECTION>::mask)) {
+        pFrag.push_back(p);
+      } else if (m_useFrag4 && ((idAndType & 0x00FF0000) >> 16) == 4) {
+        // frag4 is not unpacked, but it is still needed to recognize simulated data
+        checkDemoFragIDsMC(idAndType);
+      }
+    }
 
     p += count;
     wc += count;
@@ -1106,10 +1175,7 @@ void TileROD_Decoder::fillCollection(const ROBData * rob,
 
               rChUnit = (TileRawChannelUnit::UNIT) (unit); // Offline units in simulated data
 
-              if (!m_demoFragIDs.empty()) {
-                const_cast<Gaudi::Property<std::vector<int>> &> ( m_demoFragIDs ) = {}; // No demonstator cabling in MC
-                ATH_MSG_INFO("Disable channel remapping for demonstrator in MC");
-              }
+              checkDemoFragIDsMC(idAndType);
             }
 
             unpack_frag4(version, sizeOverhead, unit, rawchannelMetaData, p, pChannel);
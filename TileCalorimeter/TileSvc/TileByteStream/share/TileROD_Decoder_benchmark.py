@@ -0,0 +1,91 @@
+#
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration.
+#
+# File: TileByteStream/TileROD_Decoder_benchmark.py
+# Date: Oct, 2022
+# Brief: Benchmark of TileROD_Decoder on recorded Tile ByteStream.
+#
+# Prints in finalize the CPU time per event spent to convert the Tile digits
+# and raw channel containers. To compare the fragment type dispatch, run e.g.
+#   athena.py -c 'EvtMax=1000' TileByteStream/TileROD_Decoder_benchmark.py
+# once as is and once adding useFragTypeDispatch=True to the -c options.
+#
+
+from __future__ import print_function
+
+import os
+import sys
+import time
+
+# Find input file.
+RunNumber = 204073
+fpath = os.environ.get ('ATLAS_REFERENCE_DATA',
+                        '/cvmfs/atlas-nightlies.cern.ch/repo/data/data-art/Tier0ChainTests')
+input_fname = os.path.join (fpath, 'data12_8TeV.00204073.physics_JetTauEtmiss.merge.RAW._lb0144._SFO-5._0001.1')
+
+
+from AthenaCommon.DetFlags      import DetFlags
+DetFlags.detdescr.Tile_setOn()
+DetFlags.detdescr.LAr_setOn()
+
+from AtlasGeoModel import SetGeometryVersion  # noqa: F401
+from AtlasGeoModel import GeoModelInit  # noqa: F401
+from AtlasGeoModel import SetupRecoGeometry  # noqa: F401
+
+from AthenaCommon.AthenaCommonFlags  import athenaCommonFlags
+athenaCommonFlags.BSRDOInput = [input_fname]
+from ByteStreamCnvSvc import ReadByteStream  # noqa: F401
+svcMgr.EventSelector.Input = [input_fname]  # noqa: F821
+from AthenaCommon.GlobalFlags import globalflags
+globalflags.InputFormat.set_Value_and_Lock('bytestream')
+
+containers = [('TileDigitsContainer', 'TileDigitsCnt'),
+              ('TileRawChannelContainer', 'TileRawChannelCnt')]
+svcMgr.ByteStreamAddressProviderSvc.TypeNames += ['%s/%s' % c for c in containers]  # noqa: F821
+
+include('TileConditions/TileConditions_jobOptions.py')  # noqa: F821
+
+from GeoModelSvc.GeoModelSvcConf import GeoModelSvc
+ServiceMgr += GeoModelSvc()  # noqa: F821
+theApp.CreateSvc += [ "GeoModelSvc"]  # noqa: F821
+from AtlasGeoModel import TileGM  # noqa: F401
+from AtlasGeoModel import LArGM   # noqa: F401  LAr needed to get MBTS DD.
+
+from IOVDbSvc.IOVDbSvcConf import IOVDbSvc
+IOVDbSvc().GlobalTag = 'OFLCOND-RUN12-SDR-35'
+
+from AthenaCommon.AlgSequence import AlgSequence
+topSequence = AlgSequence()
+
+theApp.EvtMax = EvtMax if 'EvtMax' in dir() else 500  # noqa: F821
+
+from AthenaCommon import CfgMgr
+toolSvc = CfgMgr.ToolSvc()
+from TileByteStream.TileByteStreamConf import TileROD_Decoder
+toolSvc += TileROD_Decoder()
+toolSvc.TileROD_Decoder.fullTileMode=RunNumber
+if 'useFragTypeDispatch' in dir():
+    toolSvc.TileROD_Decoder.useFragTypeDispatch = useFragTypeDispatch  # noqa: F821
+
+
+from AthenaPython.PyAthenaComps import Alg, StatusCode
+class DecoderTimer (Alg):
+    """The containers are converted from ByteStream on the first retrieve."""
+    def initialize (self):
+        self.cpuTime = dict ((key, 0.) for _, key in containers)
+        self.nEvents = 0
+        return StatusCode.Success
+    def execute (self):
+        for _, key in containers:
+            start = time.process_time()
+            self.evtStore[key]
+            self.cpuTime[key] += time.process_time() - start
+        self.nEvents += 1
+        return StatusCode.Success
+    def finalize (self):
+        for _, key in containers:
+            print ('DecoderTimer: %s %.3f ms/event in %d events' %
+                   (key, 1000. * self.cpuTime[key] / max (self.nEvents, 1), self.nEvents))
+        sys.stdout.flush()
+        return StatusCode.Success
+topSequence += DecoderTimer ('DecoderTimer')
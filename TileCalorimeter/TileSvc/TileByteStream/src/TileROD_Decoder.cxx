@@ -174,6 +174,11 @@ StatusCode TileROD_Decoder::initialize() {
   
   updateAmpThreshold();
 
+  initFragTypeTable();
+  if (m_useFragTypeDispatch) {
+    ATH_MSG_INFO("Unpack only subfragment types needed for requested collection");
+  }
+
   // Initialize
   this->m_hashFunc.initialize(m_tileHWID);
   
@@ -225,6 +230,20 @@ StatusCode TileROD_Decoder::finalize() {
   return StatusCode::SUCCESS;
 }
 
+void TileROD_Decoder::initFragTypeTable() {
+  // unknown types are passed to the decoder which reports them
+  m_fragTypeOutput.fill(ANY_OUTPUT);
+
+  m_fragTypeOutput[0x0] = (m_useFrag0) ? DIGITS_OUTPUT : 0;
+  m_fragTypeOutput[0x1] = (m_useFrag1) ? DIGITS_OUTPUT : 0;
+  m_fragTypeOutput[0x2] = (m_useFrag4) ? RAWCHANNEL_OUTPUT : 0;
+  m_fragTypeOutput[0x3] = (m_useFrag4) ? RAWCHANNEL_OUTPUT : 0;
+  m_fragTypeOutput[0x4] = (m_useFrag4) ? RAWCHANNEL_OUTPUT : 0;
+  m_fragTypeOutput[0x5] = (m_useFrag5Raw || m_useFrag5Reco) ? (DIGITS_OUTPUT | RAWCHANNEL_OUTPUT) : 0;
+  m_fragTypeOutput[0x6] = DIGITS_OUTPUT;
+  m_fragTypeOutput[0xA] = RAWCHANNEL_OUTPUT;
+}
+
 // check if bit is set
 bool TileROD_Decoder::checkBit(const uint32_t* p, int chan) const {
   // chan = (0,47)
@@ -26,6 +26,7 @@
 #include <cassert>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 
 
@@ -303,6 +304,38 @@ void test5 (const TileROD_Decoder* decoder)
 }
 
 
+void test6 (TileROD_Decoder* decoder)
+{
+  std::cout << "test6 (fillCollection with fragment type dispatch)\n";
+
+  MyROBData data01 (findFile ("TileData-01.dump"));
+
+  auto digits = [&] () {
+    TileDigitsCollection coll (256);
+    decoder->fillCollection (&data01.rob(), coll);
+    return static_cast<std::string> (coll);
+  };
+  auto rawChannels = [&] () {
+    TileRawChannelContainer cont;
+    TileRawChannelCollection coll (256);
+    decoder->fillCollection (&data01.rob(), coll, &cont);
+    std::ostringstream os;
+    os << cont.get_unit() << " " << cont.get_type() << " " << cont.get_bsflags() << "\n"
+       << static_cast<std::string> (coll);
+    return os.str();
+  };
+
+  decoder->setUseFragTypeDispatch (false);
+  std::string digitsRef = digits();
+  std::string rawChannelsRef = rawChannels();
+
+  decoder->setUseFragTypeDispatch (true);
+  assert (digits() == digitsRef);
+  assert (rawChannels() == rawChannelsRef);
+  decoder->setUseFragTypeDispatch (false);
+}
+
+
 int main ATLAS_NOT_THREAD_SAFE ()
 {
   std::cout << "TileROD_Decoder_test\n";
@@ -321,6 +354,7 @@ int main ATLAS_NOT_THREAD_SAFE ()
   test3 (decoder.get());
   test4 (decoder.get());
   test5 (decoder.get());
+  test6 (decoder.get());
   return 0;
 }
 
@@ -369,6 +369,9 @@ StatusCode TrigFastTrackFinder::start()
 
   m_tcs.m_tripletPtMin = m_tripletMinPtFrac*m_pTmin;
 
+  //layer pairs for the seed making, shared by all events
+  m_tcs.fillLayerPairTables();
+
   return StatusCode::SUCCESS;
 }
 
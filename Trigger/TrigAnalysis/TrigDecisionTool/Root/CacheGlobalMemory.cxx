@@ -347,6 +347,20 @@ bool Trig::CacheGlobalMemory::assert_decision() const {
 void Trig::CacheGlobalMemory::reset_decision() {
   m_decisionUnpacked = false;
   m_navigationUnpacked = false;
+  std::lock_guard<std::recursive_mutex> lock(m_cgmMutex);
+  m_navigationIndex.clear();
+}
+
+const TrigCompositeUtils::NavigationIndex&
+Trig::CacheGlobalMemory::navigationIndex(const TrigCompositeUtils::Decision* terminusNode) const {
+  std::lock_guard<std::recursive_mutex> lock(m_cgmMutex);
+  std::unique_ptr<const TrigCompositeUtils::NavigationIndex>& index = m_navigationIndex[terminusNode];
+  if (!index) {
+    ATH_MSG_DEBUG("Building Run 3 navigation index");
+    index = std::make_unique<const TrigCompositeUtils::NavigationIndex>(terminusNode);
+    ATH_MSG_DEBUG("Run 3 navigation index holds " << index->size() << " nodes");
+  }
+  return *index;
 }
 
 StatusCode Trig::CacheGlobalMemory::unpackDecision(const EventContext& ctx) {
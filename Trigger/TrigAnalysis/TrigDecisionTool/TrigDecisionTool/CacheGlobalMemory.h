@@ -44,6 +44,7 @@
 #include "xAODTrigger/TrigCompositeContainer.h"
 #include "xAODTrigger/TrigDecision.h"
 #include "xAODTrigger/TrigNavigation.h"
+#include "TrigCompositeUtils/NavigationIndex.h"
 
 #ifndef XAOD_ANALYSIS // Full Athena only
 #include "EventInfo/EventInfo.h"
@@ -113,6 +114,12 @@ namespace Trig {
     }
     void navigation(HLT::TrigNavStructure* nav) { m_navigation = nav; }       //!< sets navigation object pointer
 
+    /**
+     * @brief Run 3 navigation index of the current event for the terminus node (built on first use)
+     * Shared by all ChainGroup::features calls of the event. The index is immutable and kept until the next event.
+     **/
+    const TrigCompositeUtils::NavigationIndex& navigationIndex(const TrigCompositeUtils::Decision* terminusNode) const;
+
     const std::map< std::vector< std::string >, Trig::ChainGroup* >& getChainGroups() const {return m_chainGroupsRef;};
     const std::map<std::string, std::vector<std::string> >& getStreams() const {return m_streams;};
 
@@ -189,6 +196,9 @@ namespace Trig {
     /// Navigation owned by CGM
     HLT::TrigNavStructure* m_navigation{nullptr};
 
+    /// Run 3 navigation index per terminus node (protected by mutex, the indices themselves are immutable)
+    mutable std::map< const TrigCompositeUtils::Decision*, std::unique_ptr<const TrigCompositeUtils::NavigationIndex> > m_navigationIndex ATLAS_THREAD_SAFE;
+
     // chain groups (protected by mutex)
     mutable std::map< std::vector< std::string >, Trig::ChainGroup > m_chainGroups ATLAS_THREAD_SAFE;     //!< primary storage for chain groups
     mutable std::map< std::vector< std::string >, Trig::ChainGroup* > m_chainGroupsRef ATLAS_THREAD_SAFE; //!< this map keeps the chain group more than once i.e. when alias is given
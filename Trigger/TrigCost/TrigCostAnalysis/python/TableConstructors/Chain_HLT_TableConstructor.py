@@ -1,6 +1,6 @@
 #!/usr/bin/env python
 #
-#  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+#  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 #
 
 from TrigCostAnalysis.TableConstructorBase import TableConstructorBase, Column
@@ -26,6 +26,7 @@ class Chain_HLT_TableConstructor(TableConstructorBase):
                                    "Time_perEvent",
                                    "Time_perCall",
                                    "UniqueTime_perCall",
+                                   "AttributedTime_perCall",
                                    "ChainPassed_perEvent",
                                    "Request_perEvent",
                                    "NetworkRequest_perEvent",
@@ -45,6 +46,8 @@ class Chain_HLT_TableConstructor(TableConstructorBase):
         self.columns['totalTimeFrac'] = Column("Total Chain Time [%]", "Total chain time as a percentage of the total time of all chains in this run range")
         self.columns["totalUniqTime"] = Column("Total Unique Time [s]", "Total time used by algorithms for this chain for this run range")
         self.columns['totalUniqTimeFrac'] = Column("Total Unique Time [%]", "Total unique chain time as a percentage of the total time of all chains in this run range")
+        self.columns["totalAttributedTime"] = Column("Total Attributed Time [s]", "Total time of algorithms run by this chain for this run range, with the time of algorithms shared by several chains split equally between them")
+        self.columns['totalAttributedTimeFrac'] = Column("Total Attributed Time [%]", "Total attributed chain time as a percentage of the sum of the attributed time of all chains in this run range")
         self.columns['algPerEvent'] = Column("Run Algs/Event", "Total number of algorithms executed by this chain")
         self.columns["dataRate"] = Column("Data Request Rate [Hz]", "Rate of calls to the ROS from this algorithm in this run range", True)
         self.columns["retrievedDataRate"] = Column("Retrieved ROB Rate [Hz]", "Rate of ROB retrievals from this algorithm in this run range", True)
@@ -66,6 +69,8 @@ class Chain_HLT_TableConstructor(TableConstructorBase):
         #self.columns['totalTimeFrac'] in postprocessing
         self.columns['totalUniqTime'].addValue(self.getXWeightedIntegral("UniqueTime_perCall", isLog=True) * 1e-3)
         #self.columns['totalUniqueTimeFrac'] in postprocessing
+        self.columns['totalAttributedTime'].addValue(self.getXWeightedIntegral("AttributedTime_perCall", isLog=True) * 1e-3)
+        #self.columns['totalAttributedTimeFrac'] in postprocessing
         self.columns["algPerEvent"].addValue(self.getHistogram("AlgCalls_perEvent").GetMean())
         self.columns["dataRate"].addValue(self.getXWeightedIntegral("Request_perEvent", isLog=False))
         self.columns["retrievedDataRate"].addValue(self.getXWeightedIntegral("NetworkRequest_perEvent", isLog=False))
@@ -95,6 +100,13 @@ class Chain_HLT_TableConstructor(TableConstructorBase):
         for entry in totalUniqTimeEntries:
             self.columns["totalUniqTimeFrac"].addValue(100 * entry / self.totalTime)
 
+        # Attributed times do not double count shared algorithms, normalise to their own sum
+        totalAttributedTimeEntries = self.columns["totalAttributedTime"].content
+        totalAttributedTime = sum(totalAttributedTimeEntries)
+
+        for entry in totalAttributedTimeEntries:
+            self.columns["totalAttributedTimeFrac"].addValue(0 if totalAttributedTime == 0 else 100 * entry / totalAttributedTime)
+
         passChainEntries = self.columns["passFraction"].content
         totalChains = self.columns["eventsWeighted"].content
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "CostData.h"
@@ -139,6 +139,10 @@ void CostData::setChainToUniqAlgMap( const std::map<std::string, std::set<size_t
   m_chainToUniqAlgIdx = &chainToAlgIdx;
 }
 
+void CostData::setAlgToChainCountMap( const std::map<size_t, size_t>& algToChainCount ) {
+  m_algToChainCount = &algToChainCount;
+}
+
 void CostData::setSequencersMap( const std::map<std::string, std::map<int16_t, std::set<size_t>>>& seqToAlg ) {
   m_sequencers = &seqToAlg;
 }
@@ -152,6 +156,10 @@ const std::map<std::string, std::set<size_t>>& CostData::chainToUniqAlgMap() con
   return *m_chainToUniqAlgIdx;
 }
 
+const std::map<size_t, size_t>& CostData::algToChainCountMap() const {
+  return *m_algToChainCount;
+}
+
 const std::map<std::string, std::map<int16_t, std::set<size_t>>>& CostData::sequencersMap() const {
   return *m_sequencers;
 }
@@ -88,6 +88,16 @@ class CostData {
      */
     void setChainToUniqAlgMap( const std::map<std::string, std::set<size_t>>& algToChains );
 
+    /**
+     * @brief Getter of the alg index to the number of chains sharing the algorithm map.
+     */
+    const std::map<size_t, size_t>& algToChainCountMap() const;
+
+    /**
+     * @brief Set the alg index to the number of chains sharing the algorithm map.
+     */
+    void setAlgToChainCountMap( const std::map<size_t, size_t>& algToChainCount );
+
     /**
      * @brief Getter of the sequence to alg idx map.
      */
@@ -194,6 +204,7 @@ class CostData {
     const std::map<std::string, std::vector<uint32_t>>* m_rosToRob = nullptr; //!< Mapping of ROS corresponding to ROB requests
     const std::map<std::string, std::set<size_t>>* m_chainToAlgIdx = nullptr; //!<Mapping of chain to algorithms idx
     const std::map<std::string, std::set<size_t>>* m_chainToUniqAlgIdx = nullptr; //!<Mapping of chain name to its unique algorithms
+    const std::map<size_t, size_t>* m_algToChainCount = nullptr; //!<Mapping of algorithm idx to the number of chains it was executed for
     const std::map<std::string, std::map<int16_t, std::set<size_t>>>* m_sequencers = nullptr; //!<Mapping of sequence to algorithms
     const std::vector<TrigCompositeUtils::AlgToChainTool::ChainInfo>* m_seededChains = nullptr; //!<Set of seeded chains to monitor
 
@@ -223,6 +223,7 @@ StatusCode TrigCostAnalysis::execute() {
   // Save indexes of algorithm in costDataHandle
   std::map<std::string, std::set<size_t>> chainToAlgIdx;
   std::map<std::string, std::set<size_t>> chainToUniqAlgs; // List for unique algorithms for each chain
+  std::map<size_t, size_t> algToChainCount; // Number of chains sharing each algorithm, to apportion its time
   std::map<std::string, std::map<int16_t, std::set<size_t>>> seqToAlgIdx; // Map of algorithms split in views
   std::map<std::string, std::set<std::string>> algToChain;
   m_algToChainTool->cacheSGKeys(context);
@@ -241,6 +242,9 @@ StatusCode TrigCostAnalysis::execute() {
       chainToAlgIdx[chain].insert(tc->index());
       ++i;
     }
+    if (i > 0) {
+      algToChainCount[tc->index()] = i;
+    }
 
     if (i == 1){
       ATH_MSG_DEBUG("Algorithm " << algName << " executed uniquely for " << *algToChain[algName].begin() << " chain");
@@ -275,6 +279,7 @@ StatusCode TrigCostAnalysis::execute() {
   costData.setRosToRobMap(m_rosToRob);
   costData.setChainToAlgMap(chainToAlgIdx);
   costData.setChainToUniqAlgMap(chainToUniqAlgs);
+  costData.setAlgToChainCountMap(algToChainCount);
   costData.setSequencersMap(seqToAlgIdx);
   costData.setSeededChains(seededChainsInfo);
   costData.setLb( context.eventID().lumi_block() );
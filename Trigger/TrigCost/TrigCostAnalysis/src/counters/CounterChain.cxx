@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "xAODTrigger/TrigCompositeContainer.h"
@@ -17,6 +17,10 @@ CounterChain::CounterChain(const std::string& name, const MonitorBase* parent)
   regHistogram("Time_perCall", "CPU Time/Call;Time [ms];Calls", VariableType::kPerCall, kLog, 0.01, 100000);
   regHistogram("Time_perEvent", "CPU Time/Event;Time [ms];Events", VariableType::kPerEvent);
   regHistogram("UniqueTime_perCall", "Unique CPU Time/Call;Time [ms];Calls", VariableType::kPerCall, kLog, 0.01, 100000);
+  // Shares of cheap algorithms run by many chains go well below the 0.01 ms of Time_perCall,
+  // start at 10 ns such that they do not end in the underflow bin, which the tables ignore
+  regHistogram("AttributedTime_perCall", "Attributed CPU Time/Call;Time [ms];Calls", VariableType::kPerCall, kLog, 0.00001, 100000, 100);
+  regHistogram("AttributedTime_perEvent", "Attributed CPU Time/Event;Time [ms];Events", VariableType::kPerEvent, kLog, 0.0001, 1000000, 100);
   regHistogram("ChainPassed_perEvent", "Passed chain/Event;Passsed;Events", VariableType::kPerEvent, kLinear, -0.5, 1.5, 2);
   regHistogram("Request_perEvent", "Number of requests/Event;Number of requests;Events", VariableType::kPerEvent, LogType::kLinear, -0.5, 299.5, 300);
   regHistogram("NetworkRequest_perEvent", "Number of network requests/Event;Number of requests;Events", VariableType::kPerEvent, LogType::kLinear, -0.5, 149.5, 150);
@@ -60,6 +64,12 @@ StatusCode CounterChain::newEvent(const CostData& data, size_t index, const floa
     ATH_CHECK( fill("Time_perEvent", cpuTime, weight) );
     ATH_CHECK( fill("Time_perCall", cpuTime, weight) );
 
+    // Share the time of algorithms executed for several chains equally between them,
+    // such that the attributed time summed over all chains does not double count
+    const float attributedTime = cpuTime / data.algToChainCountMap().at(algIndex);
+    ATH_CHECK( fill("AttributedTime_perEvent", attributedTime, weight) );
+    ATH_CHECK( fill("AttributedTime_perCall", attributedTime, weight) );
+
     // Monitor data requests
     if (!data.algToRequestMap().count(algIndex)) continue;
 
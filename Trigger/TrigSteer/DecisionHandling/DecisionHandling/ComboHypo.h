@@ -7,6 +7,7 @@
 // Framework includes
 #include "AthenaBaseComps/AthReentrantAlgorithm.h"
 #include "TrigCompositeUtils/TrigCompositeUtils.h"
+#include "TrigCompositeUtils/DecisionIDBitset.h"
 
 // STL includes
 #include <string>
@@ -61,6 +62,9 @@ class ComboHypo : public ::AthReentrantAlgorithm {
   Gaudi::Property<bool> m_checkMultiplicityMap { this, "CheckMultiplicityMap", true,
     "Perform a consistency check of the MultiplicitiesMap"};
 
+  /// Dense index of all chain and chain-leg IDs of the MultiplicitiesMap, for the bitset form of the passing IDs
+  TrigCompositeUtils::DecisionIDIndex m_idIndex;
+
   /**
   * @brief iterates over the inputs and for every object (no filtering) crates output object linked to input moving 
   * the decisions that are mentioned in the passing set
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 #ifndef DECISIONHANDLING_COMBOHYPOTOOLBASE_H
 #define DECISIONHANDLING_COMBOHYPOTOOLBASE_H
@@ -21,6 +21,8 @@
  * @brief Base class for tools which cut on properties of multi-object or multi-leg chains.
  * User should derive from this class and implement the executeAlg function.
  * This will be called once per combination of objects in the event which reach the ComboHypo alg which hosts this tool.
+ * Optionally, the cheaper executeAlgObject and executeAlgPair may be implemented too, to prune combinations
+ * which cannot pass before they are formed.
  **/
 
 class ComboHypoToolBase : public extends<AthAlgTool, IComboHypoTool> {
@@ -81,6 +83,20 @@ public:
   **/
   virtual bool executeAlg(const std::vector<Combo::LegDecision>& combination) const;
 
+  /**
+  * @brief Optional per-object requirement, evaluated once per Decision object before forming combinations.
+  * Must be a necessary condition for executeAlg to pass: combinations with a failing object are not formed.
+  * The default accepts all objects.
+  **/
+  virtual bool executeAlgObject(const Combo::LegDecision& /*object*/) const { return true; }
+
+  /**
+  * @brief Optional requirement on each pair of objects of a combination, evaluated once per pair in the event.
+  * Must be symmetric and a necessary condition for executeAlg to pass: no combination containing a failing pair
+  * is formed, which prunes the combinatorics of high-multiplicity events. The default accepts all pairs.
+  **/
+  virtual bool executeAlgPair(const Combo::LegDecision& /*first*/, const Combo::LegDecision& /*second*/) const { return true; }
+
   /**
   * @brief Creates the per-leg vectors of Decision objects starting from the initial LegDecision map, storing only those concerning this HypoTool's chain
   * Pack the Decision objects in std::pair<DecisionID, ElementLink<Decision>> so the derived class' executeAlg function knows which leg each object is on.
@@ -114,6 +130,9 @@ public:
 
   Gaudi::Property<bool> m_enableOverride {this, "EnableOverride", false,
     "Stops processing combinations as soon as a valid combination is found in OR mode, or as soon as an invalid combination is found in AND mode. This is to save CPU."}; 
+
+  Gaudi::Property<bool> m_enablePruning {this, "EnablePruning", true,
+    "Use executeAlgObject and executeAlgPair to skip combinations which cannot pass, before calling executeAlg."};
  
   // TODO - add optional write out of the data stored in passingCombinations in the decide function.
   
@@ -1,8 +1,10 @@
 #
-# Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+# Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 # 
 
 EnableFilterMonitoring = False  # Can be changed in a precommand/preExec
+EnableViewCreatorMonitoring = False  # Can be changed in a precommand/preExec
+MergedSuperROIInputMakers = {}  # Input maker name -> arguments of setupMergedSuperROIs, can be changed in a precommand/preExec
 
 def setupFilterMonitoring( filterAlg ):
     if not EnableFilterMonitoring or not hasattr(filterAlg, "Input"):
@@ -20,6 +22,26 @@ def setupFilterMonitoring( filterAlg ):
 
     filterAlg.MonTool = monTool
 
+def setupViewCreatorMonitoring( inputMakerAlg ):
+    """Time spent in creating vs. scheduling the EventViews of an EventViewCreatorAlgorithm"""
+    if not EnableViewCreatorMonitoring or not hasattr(inputMakerAlg, "ViewNodeName"):
+        return
+    from AthenaMonitoringKernel.GenericMonitoringTool import GenericMonitoringTool
+    monTool = GenericMonitoringTool('MonTool', HistPath='HLTFramework/ViewCreators/'+inputMakerAlg.getName())
+    monTool.defineHistogram( 'TIME_viewCreation', path='EXPERT', type='TH1F',
+                             title='Time to create and seed the views;time [ms]',
+                             xbins=100, xmin=0, xmax=10 )
+    monTool.defineHistogram( 'TIME_viewScheduling', path='EXPERT', type='TH1F',
+                             title='Time to schedule the views;time [ms]',
+                             xbins=100, xmin=0, xmax=10 )
+    monTool.defineHistogram( 'nViews', path='EXPERT', type='TH1F',
+                             title='Number of views created;views',
+                             xbins=50, xmin=0, xmax=50 )
+    monTool.defineHistogram( 'nViews,TIME_viewCreation', path='EXPERT', type='TH2F',
+                             title='Time to create the views vs. number of views;views;time [ms]',
+                             xbins=50, xmin=0, xmax=50, ybins=100, ymin=0, ymax=10 )
+    inputMakerAlg.MonTool = monTool
+
 def TriggerSummaryAlg( name ):
     from AthenaConfiguration.ComponentFactory import CompFactory
     alg = CompFactory.TriggerSummaryAlg( name )
@@ -35,3 +57,26 @@ def ComboHypoCfg( name ):
     from DecisionHandling.DecisionHandlingConf import ComboHypo
     alg = ComboHypo( name )
     return alg
+
+def setupMergedSuperROIs( inputMakerAlg, superRoIsKey, etaMargin=0.0, phiMargin=0.0, superRoILink="superRoI" ):
+    """Spawn the EventViews of an EventViewCreatorAlgorithm on super-ROIs, merging the overlapping ROIs
+    supplied by its current RoITool. The 'roi' link of each Decision object stays on its original ROI.
+    The objects reconstructed in a shared view are not split by original ROI, so this is only valid if the
+    hypos of the step select the objects inside the 'roi' of each Decision object themselves."""
+    from DecisionHandling.DecisionHandlingConf import ViewCreatorMergedSuperROITool
+    roiTool = ViewCreatorMergedSuperROITool( RoITool = inputMakerAlg.RoITool,
+                                             RoisWriteHandleKey = superRoIsKey,
+                                             EtaMargin = etaMargin,
+                                             PhiMargin = phiMargin,
+                                             SuperRoILinkName = superRoILink )
+    inputMakerAlg.RoITool = roiTool
+    inputMakerAlg.ViewRoILink = superRoILink
+    return roiTool
+
+def setupMergedSuperROIsFromPreExec( inputMakerAlg ):
+    """Apply setupMergedSuperROIs to the input makers listed in MergedSuperROIInputMakers"""
+    if not hasattr(inputMakerAlg, "RoITool") or inputMakerAlg.getName() not in MergedSuperROIInputMakers:
+        return
+    kwargs = dict( MergedSuperROIInputMakers[inputMakerAlg.getName()] )
+    kwargs.setdefault( 'superRoIsKey', 'HLT_SuperRoIs_' + inputMakerAlg.getName() )
+    setupMergedSuperROIs( inputMakerAlg, **kwargs )
@@ -80,17 +80,32 @@ StatusCode ComboHypo::initialize() {
     }
   }
 
+  DecisionIDContainer allIDs;
+  for ( const auto& [chain, multiplicities] : m_multiplicitiesReqMap ) {
+    const HLT::Identifier chainId = HLT::Identifier(chain);
+    allIDs.insert( chainId.numeric() );
+    for ( size_t legIndex = 0; legIndex < multiplicities.size(); ++legIndex ) {
+      allIDs.insert( TrigCompositeUtils::createLegName(chainId, legIndex).numeric() );
+    }
+  }
+  m_idIndex = DecisionIDIndex( allIDs );
+
   return ( errorOccured ? StatusCode::FAILURE : StatusCode::SUCCESS );
 }
 
 
 StatusCode ComboHypo::copyDecisions( const Combo::LegDecisionsMap & passingLegs, const EventContext& context ) const {
- DecisionIDContainer passing;
+  DecisionIDBitset passing = m_idIndex.bits();
   for (auto const& element : passingLegs) {
-    passing.insert(element.first);
+    const size_t index = m_idIndex.index(element.first);
+    if (index == DecisionIDIndex::npos) {
+      ATH_MSG_ERROR("Passing " << HLT::Identifier(element.first) << " is not a chain or chain-leg of the MultiplicitiesMap");
+      return StatusCode::FAILURE;
+    }
+    passing.set(index);
   }
   
-  ATH_MSG_DEBUG( "Copying "<<passing.size()<<" positive decision IDs to outputs");
+  ATH_MSG_DEBUG( "Copying "<<passing.count()<<" positive decision IDs to outputs");
 
   for ( size_t input_counter = 0; input_counter < m_inputs.size(); ++input_counter ) {
     // new output decisions
@@ -101,38 +116,35 @@ StatusCode ComboHypo::copyDecisions( const Combo::LegDecisionsMap & passingLegs,
 
       for (const Decision* inputDecision : *inputHandle) {
         auto thisEL = TrigCompositeUtils::decisionToElementLink(inputDecision, context);
-        DecisionIDContainer inputDecisionIDs;
-        decisionIDs( inputDecision, inputDecisionIDs );
 
         // from all positive decision in the input only the ones that survived counting are passed over
-        DecisionIDContainer common;      
-        std::set_intersection( inputDecisionIDs.begin(), inputDecisionIDs.end(), passing.begin(), passing.end(),
-          std::inserter( common, common.end() ) );
+        DecisionIDBitset common = m_idIndex.bits( inputDecision );
+        common &= passing;
 
         // check if this EL is in the combination map for the passing decIDs:
         ATH_MSG_DEBUG("Searching this element in the map: ("<<thisEL.dataID() << " , " << thisEL.index()<<")");
-        DecisionIDContainer finalIds;   
-        for (const DecisionID c : common){
-          const HLT::Identifier cID = HLT::Identifier(c);
+        DecisionIDBitset finalIds = m_idIndex.bits();
+        common.forEach( [&]( size_t index ) {
+          const HLT::Identifier cID = HLT::Identifier( m_idIndex.id(index) );
           // add the decID only if this candidate passed the combination selection
-          const std::vector<ElementLink<DecisionContainer>>& Comb=passingLegs.at(c);
+          const std::vector<ElementLink<DecisionContainer>>& Comb=passingLegs.at(cID.numeric());
           if(std::find(Comb.begin(), Comb.end(), thisEL) == Comb.end()) {
-            continue;
+            return;
           }
           ATH_MSG_DEBUG("  Adding "<< cID <<" because EL is found in the passingLegs map");
-          finalIds.insert( cID.numeric() ); // all Ids used by the Filter, including legs
+          finalIds.set( index ); // all Ids used by the Filter, including legs
           if (TrigCompositeUtils::isLegId ( cID )){
             const HLT::Identifier mainChain = TrigCompositeUtils::getIDFromLeg( cID );
-            finalIds.insert( mainChain.numeric() );
+            finalIds.set( m_idIndex.index( mainChain.numeric() ) );
             ATH_MSG_DEBUG("  Adding "<< mainChain <<" consequently");
           }
-        }
+        } );
 
         Decision* newDec = newDecisionIn( outDecisions, inputDecision, comboHypoAlgNodeName(), context );
         ATH_MSG_DEBUG("New decision (Container Index:" << input_counter << ", Element Index:"<< newDec->index() <<") has "
           << (TrigCompositeUtils::findLink<TrigRoiDescriptorCollection>(newDec, initialRoIString())).isValid()
-          << " valid initialRoI, "<< TrigCompositeUtils::getLinkToPrevious(newDec).size() <<" previous decisions and "<<finalIds.size()<<" decision IDs") ;   
-        insertDecisionIDs( finalIds, newDec );
+          << " valid initialRoI, "<< TrigCompositeUtils::getLinkToPrevious(newDec).size() <<" previous decisions and "<<finalIds.count()<<" decision IDs") ;   
+        m_idIndex.insert( finalIds, newDec );
 
       }
     }
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "DecisionHandling/ComboHypoToolBase.h"
@@ -74,63 +74,72 @@ StatusCode ComboHypoToolBase::decide(Combo::LegDecisionsMap& passingLegs, const
   }
 
   // Create and initialise the combinations generator for the requirements of this chain, given the objects available in this event.
-  HLT::NestedUniqueCombinationGenerator nucg;
+  HLT::PrunedCombinationGenerator pcg;
+  size_t combinationSize = 0;
   for (size_t legIndex = 0; legIndex < m_legMultiplicities.size(); ++legIndex) {
     const size_t choose_any = m_legMultiplicities.at(legIndex);
     const size_t out_of = legDecisions.at(legIndex).size();
-    nucg.add({out_of, choose_any});
+    pcg.add(out_of, choose_any);
+    combinationSize += choose_any;
     ATH_MSG_DEBUG("For leg " << legIndex << " we will be choosing any " << choose_any << " Decision Objects out of " << out_of);
   }
+  if (m_enablePruning) {
+    pcg.setElementFilter([&](size_t leg, size_t object) {
+      return executeAlgObject(legDecisions[leg][object]);
+    });
+    pcg.setPairFilter([&](size_t legA, size_t objectA, size_t legB, size_t objectB) {
+      return executeAlgPair(legDecisions[legA][objectA], legDecisions[legB][objectB]);
+    });
+  }
 
   std::vector<std::vector<Combo::LegDecision>> passingCombinations;
+  std::vector<Combo::LegDecision> combinationToCheck(combinationSize);
 
   size_t warnings = 0, iterations = 0;
-  do {
-
-    const std::vector<size_t> combination = nucg();
-    ++nucg;
-    std::vector<Combo::LegDecision> combinationToCheck;
-
-    size_t location_in_combination = 0;
-    for (size_t legIndex = 0; legIndex < m_legMultiplicities.size(); ++legIndex) {
-      // We loop over however many objects are required on the leg,
-      // but we take their index from the 'combination'. Hence 'object' is not used directly
-      for (size_t object = 0; object < static_cast<size_t>(m_legMultiplicities.at(legIndex)); ++object) {
-        const size_t objectIndex = combination.at(location_in_combination++);
-        combinationToCheck.push_back( legDecisions.at(legIndex).at(objectIndex) );
+  try {
+    pcg.run([&](const std::vector<size_t>& combination) {
+      if (m_modeOR == false and m_enableOverride and pcg.pruned()) {
+        return false; // A combination has already failed in pruning
+      }
+      // The combination holds, leg after leg, the index of each object required on the leg
+      for (size_t location_in_combination = 0, legIndex = 0; legIndex < m_legMultiplicities.size(); ++legIndex) {
+        for (size_t object = 0; object < static_cast<size_t>(m_legMultiplicities.at(legIndex)); ++object, ++location_in_combination) {
+          combinationToCheck[location_in_combination] = legDecisions[legIndex][combination[location_in_combination]];
+        }
       }
-    }
 
-    ++iterations;
+      ++iterations;
 
-    try {
       if (executeAlg(combinationToCheck)) {
         ATH_MSG_DEBUG("Combination " << (iterations - 1) << " decided to be passing");
         passingCombinations.push_back(combinationToCheck);
         if (m_modeOR == true and m_enableOverride) {
-          break;
+          return false;
         }
       } else { // the combination failed
         if (m_modeOR == false and m_enableOverride) {
-          break;
+          return false;
         }
       }
-    } catch (std::exception& e) {
-      ATH_MSG_ERROR(e.what());
-      return StatusCode::FAILURE;
-    }
 
-    if ((iterations >= m_combinationsThresholdWarn && warnings == 0) or (iterations >= m_combinationsThresholdBreak)) {
-      ATH_MSG_WARNING("Have so far processed " << iterations << " combinations for " << m_decisionId << " in this event, " << passingCombinations.size() << " passing.");
-      ++warnings;
-      if (iterations >= m_combinationsThresholdBreak) {
-        ATH_MSG_WARNING("Too many combinations! Breaking the loop at this point.");
-        break;
+      if ((iterations >= m_combinationsThresholdWarn && warnings == 0) or (iterations >= m_combinationsThresholdBreak)) {
+        ATH_MSG_WARNING("Have so far processed " << iterations << " combinations for " << m_decisionId << " in this event, " << passingCombinations.size() << " passing.");
+        ++warnings;
+        if (iterations >= m_combinationsThresholdBreak) {
+          ATH_MSG_WARNING("Too many combinations! Breaking the loop at this point.");
+          return false;
+        }
       }
-    }
-
-  } while (nucg);
+      return true;
+    });
+  } catch (std::exception& e) {
+    ATH_MSG_ERROR(e.what());
+    return StatusCode::FAILURE;
+  }
 
+  if (pcg.pruned()) {
+    ATH_MSG_DEBUG("Some combinations were pruned by executeAlgObject or executeAlgPair before calling executeAlg");
+  }
 
   if (m_modeOR) {
 
@@ -143,7 +152,8 @@ StatusCode ComboHypoToolBase::decide(Combo::LegDecisionsMap& passingLegs, const
 
   } else {  // modeAND
 
-    const bool passAll = (passingCombinations.size() == iterations);
+    // Pruned combinations are failed combinations
+    const bool passAll = (passingCombinations.size() == iterations and not pcg.pruned());
 
     ATH_MSG_DEBUG("Passing " << passingCombinations.size() << " combinations out of " << iterations << ", " 
       << m_decisionId << (passAll ? " **ACCEPTS**" : " **REJECTS**") << " this event based on AND logic.");
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "DeltaRRoIComboHypoTool.h"
@@ -63,6 +63,21 @@ bool DeltaRRoIComboHypoTool::executeAlg(const std::vector<Combo::LegDecision>& c
 }
 
 
+bool DeltaRRoIComboHypoTool::executeAlgPair(const Combo::LegDecision& first, const Combo::LegDecision& second) const
+{
+  // same float rounding and cut as executeAlg
+  const float Dr = deltaR(first, second);
+  return !(Dr > m_DRcut);
+}
+
+
+double DeltaRRoIComboHypoTool::deltaR(const Combo::LegDecision& first, const Combo::LegDecision& second) const {
+  const auto roiLink1 = TrigCompositeUtils::findLink<TrigRoiDescriptorCollection>( *first.second, initialRoIString() ).link;
+  const auto roiLink2 = TrigCompositeUtils::findLink<TrigRoiDescriptorCollection>( *second.second, initialRoIString() ).link;
+  return deltaR((*roiLink1)->eta(), (*roiLink2)->eta(), (*roiLink1)->phi(), (*roiLink2)->phi());
+}
+
+
 double DeltaRRoIComboHypoTool::deltaR(double eta1, double eta2, double phi1, double phi2) const {
   double dPhi=std::remainder( phi1 - phi2, 2*M_PI );
   double dEta=std::fabs(eta1-eta2);
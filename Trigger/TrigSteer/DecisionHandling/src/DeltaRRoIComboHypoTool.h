@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef DECISIONHANDLING_DELTARROICOMBOHYPOTOOL_H
@@ -25,6 +25,11 @@ class DeltaRRoIComboHypoTool:  public ComboHypoToolBase {
   private:
 
   bool executeAlg(const std::vector<Combo::LegDecision>& combination) const override;
+
+  /// The DR cut, applied before forming the combinations
+  bool executeAlgPair(const Combo::LegDecision& first, const Combo::LegDecision& second) const override;
+
+  double deltaR(const Combo::LegDecision& first, const Combo::LegDecision& second) const;
  
   double deltaR(double eta1, double eta2, double phi1, double phi2) const;
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 // DecisionHandling includes
@@ -14,7 +14,8 @@ using TrigCompositeUtils::Decision;
 using TrigCompositeUtils::DecisionIDContainer;
 using TrigCompositeUtils::DecisionID;
 using TrigCompositeUtils::decisionIDs;
-using TrigCompositeUtils::insertDecisionIDs;
+using TrigCompositeUtils::DecisionIDBitset;
+using TrigCompositeUtils::DecisionIDIndex;
 using TrigCompositeUtils::createAndStore;
 using TrigCompositeUtils::newDecisionIn;
 using TrigCompositeUtils::filterNodeName;
@@ -97,6 +98,20 @@ StatusCode RoRSeqFilter::initialize()
         m_chainsPerInput[i].insert( HLT::Identifier( el ).numeric() );
   }
 
+  // Filtering is done on bitsets of the chains of this filter, rather than on sets of IDs
+  DecisionIDContainer allChains;
+  for ( const HLT::Identifier& id: m_chains ) allChains.insert( id.numeric() );
+  for ( const std::set<HLT::Identifier>& chains: m_chainsPerInput ) {
+    for ( const HLT::Identifier& id: chains ) allChains.insert( id.numeric() );
+  }
+  m_chainsIndex = DecisionIDIndex( allChains );
+  m_chainsBits = m_chainsIndex.bits();
+  for ( const HLT::Identifier& id: m_chains ) m_chainsBits.set( m_chainsIndex.index( id.numeric() ) );
+  for ( const std::set<HLT::Identifier>& chains: m_chainsPerInput ) {
+    m_chainsPerInputBits.push_back( m_chainsIndex.bits() );
+    for ( const HLT::Identifier& id: chains ) m_chainsPerInputBits.back().set( m_chainsIndex.index( id.numeric() ) );
+  }
+
   if (msgLvl(MSG::DEBUG)){
     ATH_MSG_DEBUG( "Configured to require these chains: ");
     for ( const HLT::Identifier& id: m_chains )
@@ -167,9 +182,9 @@ StatusCode RoRSeqFilter::execute( const EventContext& ctx ) const {
         if ( inputHandles[inputIndex].isValid() and not inputHandles[inputIndex]->empty() ) {
           ATH_MSG_DEBUG( "Checking inputHandle: "<< inputHandles[inputIndex].key() <<" has " << inputHandles[inputIndex]->size() <<" elements");
           if ( not m_chainsPerInput.empty() ) {
-            passCounter += copyPassing( *inputHandles[inputIndex], *output, m_chainsPerInput[inputIndex], ctx );
+            passCounter += copyPassing( *inputHandles[inputIndex], *output, m_chainsPerInputBits[inputIndex], ctx );
           } else {
-            passCounter += copyPassing( *inputHandles[inputIndex], *output, m_chains, ctx );
+            passCounter += copyPassing( *inputHandles[inputIndex], *output, m_chainsBits, ctx );
           }
           ATH_MSG_DEBUG( "Recorded output key " <<  m_outputKeys[ outputIndex ].key() <<" of size "<<output->size()  <<" at index "<< outputIndex);
         }
@@ -190,35 +205,30 @@ StatusCode RoRSeqFilter::execute( const EventContext& ctx ) const {
 }
   
 size_t RoRSeqFilter::copyPassing( const DecisionContainer& input,
-                                  DecisionContainer& output, const std::set<HLT::Identifier>& topass,
+                                  DecisionContainer& output, const DecisionIDBitset& topass,
                                   const EventContext& ctx ) const {
   size_t passCounter = 0;
   for (const Decision* inputDecision : input) {
 
-    DecisionIDContainer objDecisions;      
-    decisionIDs( inputDecision, objDecisions );
+    // Only the IDs of the chains of this filter are kept in the bitset
+    DecisionIDBitset intersection = m_chainsIndex.bits( inputDecision );
 
-    ATH_MSG_DEBUG("Number of positive decisions for this input is " << objDecisions.size() <<". Now Filtering...." );
+    ATH_MSG_DEBUG("Number of positive decisions for this input is " << decisionIDs( inputDecision ).size() <<". Now Filtering...." );
 
-    DecisionIDContainer intersection;
-    std::set_intersection( topass.begin(), topass.end(),
-         objDecisions.begin(), objDecisions.end(),
-         std::inserter(intersection, intersection.end()) );
+    intersection &= topass;
 
-    if ( not intersection.empty() ) {      
+    if ( intersection.any() ) {
       // This sets up the 'self' link & the 'seed' link (seeds from inputDecision)
       Decision* decisionCopy = newDecisionIn( &output, inputDecision, filterNodeName(), ctx );
 
       // Copy accross only the DecisionIDs which have passed through this Filter for this Decision object. 
       // WARNING: Still need to 100% confirm if the correct set to propagate forward is objDecisions or intersection.
       // Tim M changing this from objDecisions (all IDs) -> intersection (only passed IDs) Feb 19
-      insertDecisionIDs(intersection, decisionCopy);     
+      m_chainsIndex.insert(intersection, decisionCopy);
       passCounter ++;
       ATH_MSG_DEBUG("Input satisfied at least one filtering chain. Chain(s) passing:");
       if (msgLvl(MSG::DEBUG)){
-      	for ( DecisionID id : intersection ) {
-	       ATH_MSG_DEBUG( " -- " << HLT::Identifier( id ) );
-	      }
+        intersection.forEach( [&]( size_t i ) { ATH_MSG_DEBUG( " -- " << HLT::Identifier( m_chainsIndex.id( i ) ) ); } );
       }
       
     } else {
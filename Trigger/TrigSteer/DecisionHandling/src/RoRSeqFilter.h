@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 #ifndef DECISIONHANDLING_RORSEQFILTER_H
 #define DECISIONHANDLING_RORSEQFILTER_H 1
@@ -12,6 +12,7 @@
 #include "AthContainers/ConstDataVector.h"
 #include "TrigCompositeUtils/TrigCompositeUtils.h"
 #include "TrigCompositeUtils/HLTIdentifier.h"
+#include "TrigCompositeUtils/DecisionIDBitset.h"
 #include "AthenaMonitoringKernel/GenericMonitoringTool.h"
 
 /**
@@ -71,6 +72,10 @@ class RoRSeqFilter
   
   Gaudi::Property<std::vector <std::vector<std::string>> > m_chainsPerInputProperty{ this, "ChainsPerInput", {}, "Chains of which this filter is concerned" };
   std::vector<std::set<HLT::Identifier>> m_chainsPerInput;
+
+  TrigCompositeUtils::DecisionIDIndex m_chainsIndex; //!< Dense index of all chains of this filter
+  TrigCompositeUtils::DecisionIDBitset m_chainsBits; //!< m_chains in the bitset form
+  std::vector<TrigCompositeUtils::DecisionIDBitset> m_chainsPerInputBits; //!< m_chainsPerInput in the bitset form
   
   /**
    * It can be used to define a custom routing from input to output collections
@@ -85,6 +90,7 @@ class RoRSeqFilter
  * one affirmative decision from the previous Stage. Considering only decisions from chains utilising this filter.
  * @param inputKey Storegate key of input, needed to link newly created decision objects to their parents.
  * @param output Writeable output container to store copies of decision objects which pass the filter.
+ * @param topass Chains to pass, as bitset of m_chainsIndex.
  * @return The number of decision objects which passed the filter.
  *
  * Produced a selective copy of all Decision objects in the input container which possess a positive decision from
@@ -93,7 +99,7 @@ class RoRSeqFilter
  **/
   size_t copyPassing( const TrigCompositeUtils::DecisionContainer& input,
                       TrigCompositeUtils::DecisionContainer& output,
-                      const std::set<HLT::Identifier>& topass,
+                      const TrigCompositeUtils::DecisionIDBitset& topass,
                       const EventContext& ctx) const;
   ToolHandle<GenericMonitoringTool> m_monTool{ this, "MonTool", "", "Filter I/O monitoring" };
 }; 
@@ -0,0 +1,158 @@
+/*
+Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TrigSteeringEvent/TrigRoiDescriptorCollection.h"
+#include "CxxUtils/phihelper.h"
+#include "ViewCreatorMergedSuperROITool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+
+using namespace TrigCompositeUtils;
+
+namespace {
+  /// Full phi width of the ROI, also for ROIs crossing the +-pi boundary
+  double phiWidth(const IRoiDescriptor& roi) {
+    const double w = roi.phiPlus() - roi.phiMinus();
+    return w < 0 ? w + 2*M_PI : w;
+  }
+
+  /// Phi in the middle of the ROI extent
+  double phiCentre(const IRoiDescriptor& roi) {
+    return CxxUtils::wrapToPi( roi.phiMinus() + 0.5*phiWidth(roi) );
+  }
+
+  /// Representative of the group of index i, for the merging of overlapping ROIs
+  size_t findGroup(std::vector<size_t>& group, size_t i) {
+    while (group[i] != i) {
+      group[i] = group[group[i]];
+      i = group[i];
+    }
+    return i;
+  }
+}
+
+
+ViewCreatorMergedSuperROITool::ViewCreatorMergedSuperROITool(const std::string& type, const std::string& name, const IInterface* parent)
+  : base_class(type, name, parent)
+  {}
+
+
+StatusCode ViewCreatorMergedSuperROITool::initialize()  {
+  ATH_CHECK(m_roiTool.retrieve());
+  ATH_CHECK(m_roisWriteHandleKey.initialize());
+  return StatusCode::SUCCESS;
+}
+
+
+TrigRoiDescriptor* ViewCreatorMergedSuperROITool::makeSuperRoI(const std::vector<const TrigRoiDescriptor*>& constituents) {
+  // The envelope of the constituents, with phi measured from the first constituent to handle the wrap-around
+  const double phiRef = phiCentre(*constituents.front());
+  double etaMinus = constituents.front()->etaMinus(), etaPlus = constituents.front()->etaPlus();
+  double zedMinus = constituents.front()->zedMinus(), zedPlus = constituents.front()->zedPlus();
+  double phiLow = 0, phiHigh = 0;
+  for (const TrigRoiDescriptor* roi : constituents) {
+    etaMinus = std::min(etaMinus, static_cast<double>(roi->etaMinus()));
+    etaPlus  = std::max(etaPlus,  static_cast<double>(roi->etaPlus()));
+    zedMinus = std::min(zedMinus, static_cast<double>(roi->zedMinus()));
+    zedPlus  = std::max(zedPlus,  static_cast<double>(roi->zedPlus()));
+    const double dphi = CxxUtils::wrapToPi( phiCentre(*roi) - phiRef );
+    phiLow  = std::min(phiLow,  dphi - 0.5*phiWidth(*roi));
+    phiHigh = std::max(phiHigh, dphi + 0.5*phiWidth(*roi));
+  }
+  double phi = CxxUtils::wrapToPi( phiRef + 0.5*(phiLow + phiHigh) );
+  double phiMinus = CxxUtils::wrapToPi( phiRef + phiLow );
+  double phiPlus  = CxxUtils::wrapToPi( phiRef + phiHigh );
+  if (phiHigh - phiLow >= 2*M_PI) {
+    phi = 0;
+    phiMinus = -M_PI;
+    phiPlus  =  M_PI;
+  }
+
+  TrigRoiDescriptor* superRoI = new TrigRoiDescriptor(0.5*(etaMinus + etaPlus), etaMinus, etaPlus,
+                                                      phi, phiMinus, phiPlus,
+                                                      0.5*(zedMinus + zedPlus), zedMinus, zedPlus);
+  superRoI->setComposite(true);
+  superRoI->manageConstituents(false); // Note: constituents are owned by the collection of the RoITool
+  for (const TrigRoiDescriptor* roi : constituents) {
+    superRoI->push_back(roi);
+  }
+  return superRoI;
+}
+
+
+bool ViewCreatorMergedSuperROITool::overlap(const IRoiDescriptor& a, const IRoiDescriptor& b, double etaMargin, double phiMargin) {
+  if (a.etaMinus() > b.etaPlus() + etaMargin || b.etaMinus() > a.etaPlus() + etaMargin) return false;
+  if (a.zedMinus() > b.zedPlus() || b.zedMinus() > a.zedPlus()) return false;
+  const double dphi = std::abs( CxxUtils::wrapToPi( phiCentre(a) - phiCentre(b) ) );
+  return dphi <= 0.5*(phiWidth(a) + phiWidth(b)) + phiMargin;
+}
+
+
+StatusCode ViewCreatorMergedSuperROITool::attachROILinks(TrigCompositeUtils::DecisionContainer& decisions, const EventContext& ctx) const {
+  ATH_CHECK(m_roiTool->attachROILinks(decisions, ctx));
+
+  SG::WriteHandle<TrigRoiDescriptorCollection> roisWriteHandle = createAndStoreNoAux(m_roisWriteHandleKey, ctx);
+
+  std::vector<ElementLink<TrigRoiDescriptorCollection>> roiELs;
+  roiELs.reserve(decisions.size());
+  for (const Decision* decision : decisions) {
+    if (!decision->hasObjectLink(roiString(), ClassID_traits<TrigRoiDescriptorCollection>::ID())) {
+      ATH_MSG_ERROR("No '" << roiString() << "' link was attached by " << m_roiTool.name() << " to Decision object index " << decision->index());
+      return StatusCode::FAILURE;
+    }
+    roiELs.push_back(decision->objectLink<TrigRoiDescriptorCollection>(roiString()));
+    ATH_CHECK(roiELs.back().isValid());
+  }
+
+  // Group Decision objects with directly or transitively overlapping ROIs
+  std::vector<size_t> group(decisions.size());
+  std::iota(group.begin(), group.end(), 0);
+  auto mergeable = [](const TrigRoiDescriptor* roi) { return !roi->isFullscan() && !roi->composite(); };
+  for (size_t i = 0; i < roiELs.size(); ++i) {
+    if (!mergeable(*roiELs[i])) continue;
+    for (size_t j = i + 1; j < roiELs.size(); ++j) {
+      if (!mergeable(*roiELs[j])) continue;
+      if (roiELs[i] == roiELs[j] || overlap(**roiELs[i], **roiELs[j], m_etaMargin, m_phiMargin)) {
+        group[findGroup(group, j)] = findGroup(group, i);
+      }
+    }
+  }
+  std::map<size_t, std::vector<size_t>> members;
+  for (size_t i = 0; i < group.size(); ++i) {
+    members[findGroup(group, i)].push_back(i);
+  }
+
+  for (const auto& [representative, indices] : members) {
+    std::vector<const TrigRoiDescriptor*> constituents;
+    for (size_t i : indices) {
+      if (std::find(constituents.begin(), constituents.end(), *roiELs[i]) == constituents.end()) {
+        constituents.push_back(*roiELs[i]);
+      }
+    }
+    if (constituents.size() < 2) {
+      // Nothing to merge, the view is spawned on the ROI from the RoITool
+      for (size_t i : indices) {
+        decisions.at(i)->setObjectLink(m_superRoILinkName.value(), roiELs[i]);
+      }
+      continue;
+    }
+
+    TrigRoiDescriptor* superRoI = makeSuperRoI(constituents);
+    roisWriteHandle->push_back(superRoI);
+
+    ATH_MSG_DEBUG("Merged " << constituents.size() << " overlapping ROIs of " << indices.size() << " Decision objects into super-ROI " << *superRoI);
+
+    // All Decision objects of the group share the super-ROI, and with it the EventView spawned on it.
+    // Their 'roi' link stays on their own ROI.
+    const ElementLink<TrigRoiDescriptorCollection> superRoIEL = ElementLink<TrigRoiDescriptorCollection>(*roisWriteHandle, roisWriteHandle->size() - 1, ctx);
+    for (size_t i : indices) {
+      decisions.at(i)->setObjectLink(m_superRoILinkName.value(), superRoIEL);
+    }
+  }
+
+  return StatusCode::SUCCESS;
+}
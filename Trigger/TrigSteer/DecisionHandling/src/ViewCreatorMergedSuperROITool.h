@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef DECISIONHANDLING_VIEWCREATORMERGEDSUPERROITOOL_H
+#define DECISIONHANDLING_VIEWCREATORMERGEDSUPERROITOOL_H
+
+#include "AthenaBaseComps/AthAlgTool.h"
+#include "GaudiKernel/ToolHandle.h"
+#include "StoreGate/WriteHandleKey.h"
+#include "DecisionHandling/IViewCreatorROITool.h"
+#include "TrigSteeringEvent/TrigRoiDescriptorCollection.h"
+
+/**
+ * @class ViewCreatorMergedSuperROITool
+ * Merges overlapping ROIs of the Decision objects of one step into composite super-ROIs.
+ *
+ * The ROIs are first obtained from the wrapped RoITool. Decision objects whose ROIs overlap in eta, phi and z
+ * (directly or through a chain of overlapping ROIs) are then all linked to one super-ROI, which has the
+ * original ROIs as constituents and their envelope as its own extent.
+ *
+ * The super-ROI is linked under SuperRoILinkName, the 'roi' link of each Decision object stays on its original ROI.
+ * The parent EventViewCreatorAlgorithm is to be configured with ViewRoILink set to SuperRoILinkName: it then spawns
+ * one EventView per super-ROI, and the data preparation and tracking run once per super-ROI instead of once per
+ * original ROI. Later steps and hypos which follow the 'roi' link get the original ROI of the Decision object.
+ *
+ * The objects reconstructed in a shared view are not split between the original ROIs: every Decision object of a
+ * merged group sees all tracks, clusters etc. of the super-ROI. The tool is therefore only to be used in front of
+ * hypos which select the objects inside the 'roi' of each Decision object themselves.
+ *
+ * Full-scan and composite ROIs, and ROIs not overlapping any other, are linked as their own super-ROI.
+ **/
+class ViewCreatorMergedSuperROITool: public extends<AthAlgTool, IViewCreatorROITool>
+{
+public:
+  ViewCreatorMergedSuperROITool(const std::string& type, const std::string& name, const IInterface* parent);
+
+  virtual ~ViewCreatorMergedSuperROITool() = default;
+
+  virtual StatusCode initialize() override;
+
+  /**
+   * @brief Tool interface method.
+   **/
+  virtual StatusCode attachROILinks(TrigCompositeUtils::DecisionContainer& decisions, const EventContext& ctx) const override;
+
+  /**
+   * @brief Do the two ROIs overlap, within the given margins? Handles the phi wrap-around.
+   **/
+  static bool overlap(const IRoiDescriptor& a, const IRoiDescriptor& b, double etaMargin, double phiMargin);
+
+  /**
+   * @brief Composite ROI spanning the envelope of the constituents, which are not owned. Handles the phi wrap-around.
+   **/
+  static TrigRoiDescriptor* makeSuperRoI(const std::vector<const TrigRoiDescriptor*>& constituents);
+
+private:
+
+  ToolHandle<IViewCreatorROITool> m_roiTool{this, "RoITool", "",
+    "Tool supplying the ROIs to be merged"};
+
+  SG::WriteHandleKey< TrigRoiDescriptorCollection > m_roisWriteHandleKey {this,"RoisWriteHandleKey","",
+    "Name of the super-ROI collection produced by this tool."};
+
+  Gaudi::Property< std::string > m_superRoILinkName{this, "SuperRoILinkName", "superRoI",
+    "Name of the link to the super-ROI on each Decision object, on which the EventView is to be spawned"};
+
+  Gaudi::Property< double > m_etaMargin{this, "EtaMargin", 0.0,
+    "ROIs closer than this in eta are merged, even if they do not overlap"};
+
+  Gaudi::Property< double > m_phiMargin{this, "PhiMargin", 0.0,
+    "ROIs closer than this in phi are merged, even if they do not overlap"};
+
+};
+
+#endif //> !DECISIONHANDLING_VIEWCREATORMERGEDSUPERROITOOL_H
@@ -18,6 +18,7 @@
 #include "../ViewCreatorCentredOnJetWithPVConstraintROITool.h"
 #include "../ViewCreatorJetSuperROITool.h"
 #include "../ViewCreatorDVROITool.h"
+#include "../ViewCreatorMergedSuperROITool.h"
 #include "../ITestHypoTool.h"
 #include "../TestHypoAlg.h"
 #include "../TestHypoTool.h"
@@ -50,3 +51,4 @@ DECLARE_COMPONENT( ViewCreatorCentredOnClusterROITool )
 DECLARE_COMPONENT( ViewCreatorCentredOnJetWithPVConstraintROITool )
 DECLARE_COMPONENT( ViewCreatorJetSuperROITool )
 DECLARE_COMPONENT( ViewCreatorDVROITool )
+DECLARE_COMPONENT( ViewCreatorMergedSuperROITool )
@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include "TestTools/expect.h"
+#include "CxxUtils/phihelper.h"
+#include "TrigSteeringEvent/TrigRoiDescriptor.h"
+#include "../src/ViewCreatorMergedSuperROITool.h"
+
+bool near(double a, double b) { return std::abs(a - b) < 1e-4; }
+
+int main() {
+  using Tool = ViewCreatorMergedSuperROITool;
+
+  // Overlap in eta, phi and z
+  const TrigRoiDescriptor a(0.5, 0.4, 0.6, 1.0, 0.9, 1.1);
+  const TrigRoiDescriptor b(0.65, 0.55, 0.75, 1.05, 0.95, 1.15);
+  const TrigRoiDescriptor c(1.0, 0.9, 1.1, 1.0, 0.9, 1.1);
+  VALUE( Tool::overlap(a, b, 0, 0) ) EXPECTED( true );
+  VALUE( Tool::overlap(b, a, 0, 0) ) EXPECTED( true );
+  VALUE( Tool::overlap(a, c, 0, 0) ) EXPECTED( false );
+  VALUE( Tool::overlap(a, c, 0.35, 0) ) EXPECTED( true );
+
+  const TrigRoiDescriptor farPhi(0.5, 0.4, 0.6, 1.5, 1.4, 1.6);
+  VALUE( Tool::overlap(a, farPhi, 0, 0) ) EXPECTED( false );
+  VALUE( Tool::overlap(a, farPhi, 0, 0.35) ) EXPECTED( true );
+
+  const TrigRoiDescriptor otherZ(0.5, 0.4, 0.6, 1.0, 0.9, 1.1, 150, 100, 200);
+  const TrigRoiDescriptor thisZ(0.5, 0.4, 0.6, 1.0, 0.9, 1.1, -150, -200, -100);
+  VALUE( Tool::overlap(otherZ, thisZ, 0, 0) ) EXPECTED( false );
+
+  // Overlap across the phi = +-pi boundary
+  const TrigRoiDescriptor d(0.0, -0.1, 0.1, 3.05, 2.95, CxxUtils::wrapToPi(3.15));
+  const TrigRoiDescriptor e(0.05, -0.05, 0.15, -3.07, -3.14, -3.0);
+  const TrigRoiDescriptor f(0.0, -0.1, 0.1, 0.0, -0.1, 0.1);
+  VALUE( Tool::overlap(d, e, 0, 0) ) EXPECTED( true );
+  VALUE( Tool::overlap(e, d, 0, 0) ) EXPECTED( true );
+  VALUE( Tool::overlap(d, f, 0, 0) ) EXPECTED( false );
+
+  // Envelope of two ROIs
+  std::unique_ptr<TrigRoiDescriptor> ab(Tool::makeSuperRoI({&a, &b}));
+  VALUE( ab->composite() ) EXPECTED( true );
+  VALUE( ab->size() ) EXPECTED( 2u );
+  VALUE( near(ab->etaMinus(), 0.4) && near(ab->etaPlus(), 0.75) && near(ab->eta(), 0.575) ) EXPECTED( true );
+  VALUE( near(ab->phiMinus(), 0.9) && near(ab->phiPlus(), 1.15) && near(ab->phi(), 1.025) ) EXPECTED( true );
+
+  // Envelope across the phi = +-pi boundary
+  std::unique_ptr<TrigRoiDescriptor> de(Tool::makeSuperRoI({&d, &e}));
+  VALUE( de->size() ) EXPECTED( 2u );
+  VALUE( near(de->etaMinus(), -0.1) && near(de->etaPlus(), 0.15) ) EXPECTED( true );
+  VALUE( near(de->phiMinus(), 2.95) ) EXPECTED( true );
+  VALUE( near(de->phiPlus(), -3.0) ) EXPECTED( true );
+  VALUE( near(de->phi(), CxxUtils::wrapToPi(0.5*(2.95 + 2*M_PI - 3.0))) ) EXPECTED( true );
+
+  std::cout << "ok" << std::endl;
+  return 0;
+}
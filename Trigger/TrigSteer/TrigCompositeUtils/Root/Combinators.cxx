@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 #include <algorithm>
 #include <numeric>
@@ -124,6 +124,92 @@ void NestedUniqueCombinationGenerator::cache() {
   }
 }
 
+
+void PrunedCombinationGenerator::add( size_t nelems, size_t comblen ) {
+  m_firstSlot.push_back( m_slotCollection.size() );
+  m_elementOffset.push_back( m_totalElements );
+  m_nElements.push_back( nelems );
+  m_combLen.push_back( comblen );
+  m_slotCollection.insert( m_slotCollection.end(), comblen, m_nElements.size() - 1 );
+  m_totalElements += nelems;
+  // Same order as NestedUniqueCombinationGenerator: the first collection changes fastest,
+  // and within a collection the last index does
+  m_slotOrder.clear();
+  for ( size_t coll = m_nElements.size(); coll-- > 0; ) {
+    for ( size_t slot = m_firstSlot[coll]; slot < m_firstSlot[coll] + m_combLen[coll]; ++slot ) {
+      m_slotOrder.push_back( slot );
+    }
+  }
+}
+
+bool PrunedCombinationGenerator::run( const Handler& handle ) {
+  m_pruned = false;
+  m_candidates.clear();
+  m_candidateBegin.clear();
+  for ( size_t coll = 0; coll < m_nElements.size(); ++coll ) {
+    m_candidateBegin.push_back( m_candidates.size() );
+    for ( size_t el = 0; el < m_nElements[coll]; ++el ) {
+      if ( not m_elementFilter or m_elementFilter( coll, el ) ) {
+        m_candidates.push_back( el );
+      } else {
+        m_pruned = true;
+      }
+    }
+  }
+  m_candidateBegin.push_back( m_candidates.size() );
+  if ( m_pairFilter ) {
+    m_pairCache.assign( m_totalElements * m_totalElements, 0 );
+  }
+  m_current.assign( m_slotCollection.size(), 0 );
+  m_position.assign( m_slotCollection.size(), 0 );
+  if ( m_current.empty() ) return true;
+  return next( 0, handle );
+}
+
+bool PrunedCombinationGenerator::pairPasses( size_t collA, size_t elA, size_t collB, size_t elB ) {
+  const size_t a = m_elementOffset[collA] + elA;
+  const size_t b = m_elementOffset[collB] + elB;
+  uint8_t& cached = m_pairCache[ std::min(a, b) * m_totalElements + std::max(a, b) ];
+  if ( cached == 0 ) {
+    cached = m_pairFilter( collA, elA, collB, elB ) ? 1 : 2;
+  }
+  return cached == 1;
+}
+
+bool PrunedCombinationGenerator::next( size_t depth, const Handler& handle ) {
+  if ( depth == m_slotOrder.size() ) {
+    return handle( m_current );
+  }
+  const size_t slot = m_slotOrder[depth];
+  const size_t coll = m_slotCollection[slot];
+  const size_t begin = m_candidateBegin[coll];
+  const size_t end = m_candidateBegin[coll + 1];
+  // Unique combinations: increasing positions within the collection, leaving room for the remaining ones
+  const size_t start = ( slot == m_firstSlot[coll] ) ? begin : m_position[slot - 1] + 1;
+  const size_t remaining = m_firstSlot[coll] + m_combLen[coll] - slot;
+  for ( size_t pos = start; pos + remaining <= end; ++pos ) {
+    const size_t el = m_candidates[pos];
+    bool pass = true;
+    if ( m_pairFilter ) {
+      for ( size_t d = 0; d < depth; ++d ) {
+        const size_t other = m_slotOrder[d];
+        if ( not pairPasses( m_slotCollection[other], m_current[other], coll, el ) ) {
+          pass = false;
+          break;
+        }
+      }
+    }
+    if ( not pass ) {
+      m_pruned = true;
+      continue;
+    }
+    m_current[slot] = el;
+    m_position[slot] = pos;
+    if ( not next( depth + 1, handle ) ) return false;
+  }
+  return true;
+}
+
 namespace {
   
   void combMaker( const Index2DVec& indices, std::function<void (const Index1DVec&) >&& handle, std::function<bool (const Index1DVec&) >&& filter, size_t rank=0, Index1DVec combination={} ) {
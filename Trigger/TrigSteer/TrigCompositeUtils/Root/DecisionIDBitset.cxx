@@ -0,0 +1,94 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TrigCompositeUtils/DecisionIDBitset.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace TrigCompositeUtils {
+
+  bool DecisionIDBitset::any() const {
+    return std::any_of(m_words.begin(), m_words.end(), [](uint64_t w) { return w != 0; });
+  }
+
+  size_t DecisionIDBitset::count() const {
+    size_t n = 0;
+    for (uint64_t w : m_words) n += CxxUtils::count_ones(w);
+    return n;
+  }
+
+  bool DecisionIDBitset::intersects(const DecisionIDBitset& other) const {
+    const size_t n = std::min(m_words.size(), other.m_words.size());
+    for (size_t w = 0; w < n; ++w) {
+      if (m_words[w] & other.m_words[w]) return true;
+    }
+    return false;
+  }
+
+  DecisionIDBitset& DecisionIDBitset::operator&=(const DecisionIDBitset& other) {
+    const size_t n = std::min(m_words.size(), other.m_words.size());
+    for (size_t w = 0; w < n; ++w) m_words[w] &= other.m_words[w];
+    std::fill(m_words.begin() + n, m_words.end(), 0);
+    return *this;
+  }
+
+  DecisionIDBitset& DecisionIDBitset::operator|=(const DecisionIDBitset& other) {
+    if (other.m_words.size() > m_words.size()) m_words.resize(other.m_words.size(), 0);
+    for (size_t w = 0; w < other.m_words.size(); ++w) m_words[w] |= other.m_words[w];
+    return *this;
+  }
+
+
+  DecisionIDIndex::DecisionIDIndex(const DecisionIDContainer& ids)
+    : m_ids(ids.begin(), ids.end()) {
+    m_index.reserve(m_ids.size());
+    for (size_t i = 0; i < m_ids.size(); ++i) {
+      m_index.emplace(m_ids[i], i);
+    }
+  }
+
+  size_t DecisionIDIndex::index(DecisionID id) const {
+    const auto it = m_index.find(id);
+    return it == m_index.end() ? npos : it->second;
+  }
+
+  DecisionIDBitset DecisionIDIndex::bits(const DecisionIDContainer& ids) const {
+    DecisionIDBitset result = bits();
+    for (DecisionID id : ids) {
+      const size_t i = index(id);
+      if (i != npos) result.set(i);
+    }
+    return result;
+  }
+
+  DecisionIDBitset DecisionIDIndex::bits(const Decision* d) const {
+    DecisionIDBitset result = bits();
+    for (DecisionID id : decisionIDs(d)) {
+      const size_t i = index(id);
+      if (i != npos) result.set(i);
+    }
+    return result;
+  }
+
+  DecisionIDContainer DecisionIDIndex::toSet(const DecisionIDBitset& bits) const {
+    DecisionIDContainer result;
+    bits.forEach([&](size_t i) { result.insert(result.end(), m_ids[i]); });
+    return result;
+  }
+
+  void DecisionIDIndex::insert(const DecisionIDBitset& bits, Decision* dest) const {
+    std::vector<DecisionID> src;
+    bits.forEach([&](size_t i) { src.push_back(m_ids[i]); }); // Sorted, as the index is
+    std::vector<DecisionID>& destIDs = decisionIDs(dest);
+    // The destination may have been filled unordered via addDecisionID
+    std::sort(destIDs.begin(), destIDs.end());
+    std::vector<DecisionID> merged;
+    merged.reserve(src.size() + destIDs.size());
+    std::set_union(destIDs.begin(), destIDs.end(), src.begin(), src.end(), std::back_inserter(merged));
+    merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+    destIDs.swap(merged);
+  }
+
+}
@@ -0,0 +1,159 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TrigCompositeUtils/NavigationIndex.h"
+
+#include <algorithm>
+
+namespace TrigCompositeUtils {
+
+  NavigationIndex::NavigationIndex(const Decision* terminus) {
+    if (terminus) {
+      add(terminus);
+    }
+  }
+
+
+  uint32_t NavigationIndex::index(const Decision* node) const {
+    const auto it = m_nodeIndex.find(node);
+    return (it == m_nodeIndex.end() ? npos : it->second);
+  }
+
+
+  uint32_t NavigationIndex::add(const Decision* node) {
+    const uint32_t existing = index(node);
+    if (existing != npos) {
+      return existing;
+    }
+
+    auto discover = [this](const Decision* d) -> uint32_t {
+      const auto [it, inserted] = m_nodeIndex.emplace(d, static_cast<uint32_t>(m_nodes.size()));
+      if (inserted) {
+        m_nodes.push_back(d);
+      }
+      return it->second;
+    };
+
+    const uint32_t added = discover(node);
+    // Nodes are explored in index order, so the seeds and IDs of each node are appended contiguously
+    for (size_t next = added; next < m_nodes.size(); ++next) {
+      const Decision* d = m_nodes[next];
+      if (hasLinkToPrevious(d)) {
+        for (const ElementLink<DecisionContainer>& seed : getLinkToPrevious(d)) {
+          const Decision* seedDecision = *(seed); // Dereference ElementLink, once per event
+          if (seedDecision) {
+            m_seeds.push_back(discover(seedDecision));
+          }
+        }
+      }
+      m_seedOffsets.push_back(m_seeds.size());
+      const std::vector<DecisionID>& ids = decisionIDs(d);
+      m_ids.insert(m_ids.end(), ids.begin(), ids.end());
+      m_idOffsets.push_back(m_ids.size());
+    }
+    return added;
+  }
+
+
+  bool NavigationIndex::isAnyIDPassing(uint32_t i, const DecisionIDContainer& required) const {
+    for (uint32_t n = m_idOffsets[i]; n < m_idOffsets[i + 1]; ++n) {
+      if (required.count(m_ids[n]) > 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  void NavigationIndex::getDecisions(const Decision* start,
+    NavGraph& navGraph,
+    const EventContext& ctx,
+    const DecisionIDContainer& ids,
+    const bool enforceDecisionOnStartNode) const {
+
+    Explored explored;
+    explored.indexed.resize(m_nodes.size(), false);
+    const uint32_t startIndex = index(start);
+    if (startIndex != npos) {
+      getDecisionsInternal(startIndex, /*comingFrom*/nullptr, navGraph, ctx, explored, ids, enforceDecisionOnStartNode);
+    } else {
+      getDecisionsInternal(start, /*comingFrom*/nullptr, navGraph, ctx, explored, ids, enforceDecisionOnStartNode);
+    }
+  }
+
+
+  void NavigationIndex::getDecisionsInternal(uint32_t node,
+    const Decision* comingFrom,
+    NavGraph& navGraph,
+    const EventContext& ctx,
+    Explored& explored,
+    const DecisionIDContainer& ids,
+    const bool enforceDecisionOnNode) const {
+
+    // Does this Decision satisfy the chain requirement?
+    if (enforceDecisionOnNode && ids.size() != 0 && !isAnyIDPassing(node, ids)) {
+      return; // Stop propagating down this leg. It does not concern the chain with DecisionID = id
+    }
+
+    // This Decision object is part of this path through the Navigation
+    navGraph.addNode(m_nodes[node], ctx, comingFrom);
+
+#if TRIGCOMPUTILS_ENABLE_EARLY_EXIT == 1
+    if (explored.indexed[node]) {
+      // We have fully explored this branch
+      return;
+    }
+#endif
+
+    // Continue to the path(s) by looking at this Decision object's seed(s)
+    for (uint32_t n = m_seedOffsets[node]; n < m_seedOffsets[node + 1]; ++n) {
+      getDecisionsInternal(m_seeds[n], m_nodes[node], navGraph, ctx, explored, ids, /*enforceDecisionOnNode*/ true);
+    }
+
+    // Have fully explored down from this point
+    explored.indexed[node] = true;
+  }
+
+
+  void NavigationIndex::getDecisionsInternal(const Decision* node,
+    const Decision* comingFrom,
+    NavGraph& navGraph,
+    const EventContext& ctx,
+    Explored& explored,
+    const DecisionIDContainer& ids,
+    const bool enforceDecisionOnNode) const {
+
+    // Does this Decision satisfy the chain requirement?
+    if (enforceDecisionOnNode && ids.size() != 0 && !TrigCompositeUtils::isAnyIDPassing(node, ids)) {
+      return; // Stop propagating down this leg. It does not concern the chain with DecisionID = id
+    }
+
+    // This Decision object is part of this path through the Navigation
+    navGraph.addNode(node, ctx, comingFrom);
+
+#if TRIGCOMPUTILS_ENABLE_EARLY_EXIT == 1
+    if (explored.other.count(node) == 1) {
+      // We have fully explored this branch
+      return;
+    }
+#endif
+
+    // Continue to the path(s) by looking at this Decision object's seed(s)
+    if (hasLinkToPrevious(node)) {
+      for (const ElementLink<DecisionContainer>& seed : getLinkToPrevious(node)) {
+        const Decision* seedDecision = *(seed); // Dereference ElementLink
+        const uint32_t seedIndex = index(seedDecision);
+        if (seedIndex != npos) {
+          getDecisionsInternal(seedIndex, node, navGraph, ctx, explored, ids, /*enforceDecisionOnNode*/ true);
+        } else {
+          getDecisionsInternal(seedDecision, node, navGraph, ctx, explored, ids, /*enforceDecisionOnNode*/ true);
+        }
+      }
+    }
+
+    // Have fully explored down from this point
+    explored.other.insert(node);
+  }
+
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -9,6 +9,7 @@
 #include <vector>
 #include <set>
 #include <functional>
+#include <cstdint>
 
 namespace HLT {
   /**
@@ -87,6 +88,65 @@ namespace HLT {
     void cache();
   };
 
+  /**
+   * Generator of the same nested unique combinations as NestedUniqueCombinationGenerator, in the same order,
+   * with early pruning of partial combinations.
+   *
+   * The optional element filter is evaluated once per element of each collection, failing elements never enter
+   * a combination. The optional pair filter is evaluated when an element is added to a partial combination, against
+   * each element already in it. If it fails, none of the combinations starting with this partial combination are formed.
+   * The pair filter must be symmetric, its result is cached per pair of elements for the duration of run().
+   * Both filters should be necessary conditions of the full selection of a combination, then pruning is exact.
+   *
+   * Combinations are stored in preallocated flat arrays, no allocation happens while iterating.
+   **/
+  class PrunedCombinationGenerator {
+  public:
+    typedef std::function<bool(size_t collection, size_t element)> ElementFilter;
+    typedef std::function<bool(size_t collectionA, size_t elementA, size_t collectionB, size_t elementB)> PairFilter;
+    typedef std::function<bool(const std::vector<size_t>& combination)> Handler;
+
+    /**
+     * @brief add a collection of nelems elements, from which unique combinations of comblen elements are formed
+     **/
+    void add( size_t nelems, size_t comblen );
+    size_t size() const { return m_slotCollection.size(); }
+
+    void setElementFilter( ElementFilter&& filter ) { m_elementFilter = std::move(filter); }
+    void setPairFilter( PairFilter&& filter ) { m_pairFilter = std::move(filter); }
+
+    /**
+     * @brief calls handle for every combination passing the filters, combinations are laid out as in NestedUniqueCombinationGenerator
+     * @return false if the handle stopped the iteration by returning false
+     **/
+    bool run( const Handler& handle );
+
+    /**
+     * @brief were combinations removed by the filters in the last run()
+     **/
+    bool pruned() const { return m_pruned; }
+
+  private:
+    bool next( size_t depth, const Handler& handle );
+    bool pairPasses( size_t collA, size_t elA, size_t collB, size_t elB );
+
+    std::vector<size_t> m_nElements;       //!< per collection: number of elements
+    std::vector<size_t> m_combLen;         //!< per collection: combination length
+    std::vector<size_t> m_firstSlot;       //!< per collection: first position in the combination
+    std::vector<size_t> m_elementOffset;   //!< per collection: offset of its elements in the flat element index
+    std::vector<size_t> m_slotCollection;  //!< per combination position: its collection
+    std::vector<size_t> m_slotOrder;       //!< order in which the positions are filled, last collection outermost
+    std::vector<size_t> m_candidates;      //!< elements passing the element filter, flat over collections
+    std::vector<size_t> m_candidateBegin;  //!< per collection: start of its candidates, plus the end
+    std::vector<uint8_t> m_pairCache;      //!< pair filter results over the flat element index: 0 unknown, 1 pass, 2 fail
+    std::vector<size_t> m_current;
+    std::vector<size_t> m_position;        //!< per combination position: position in the candidates of the collection
+    size_t m_totalElements = 0;
+    bool m_pruned = false;
+    ElementFilter m_elementFilter;
+    PairFilter m_pairFilter;
+  };
+
   /**
    * @class Utility class to generate combinations dierctly with collections and their respective iterators
    * The usage is expected to be:
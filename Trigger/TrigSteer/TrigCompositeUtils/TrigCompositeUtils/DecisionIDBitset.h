@@ -0,0 +1,113 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef TrigCompositeUtils_DecisionIDBitset_h
+#define TrigCompositeUtils_DecisionIDBitset_h
+
+#include "TrigCompositeUtils/TrigCompositeUtils.h"
+#include "CxxUtils/bitscan.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace TrigCompositeUtils {
+
+  /**
+   * @class DecisionIDBitset
+   * @brief Dense set of DecisionIDs, one bit per entry of a DecisionIDIndex.
+   *
+   * Set operations are word-wise, i.e. O(number of indexed IDs / 64). Bitsets are only
+   * comparable if they were created by the same DecisionIDIndex.
+   **/
+  class DecisionIDBitset {
+    public:
+      DecisionIDBitset() = default;
+      explicit DecisionIDBitset(size_t nBits) : m_words((nBits + 63) / 64, 0) {}
+
+      void set(size_t i) { m_words[i / 64] |= (uint64_t(1) << (i % 64)); }
+      bool test(size_t i) const { return (m_words[i / 64] >> (i % 64)) & 1; }
+
+      /// @return true if any bit is set
+      bool any() const;
+
+      /// @return number of set bits
+      size_t count() const;
+
+      /// @return true if any bit is set in both bitsets
+      bool intersects(const DecisionIDBitset& other) const;
+
+      DecisionIDBitset& operator&=(const DecisionIDBitset& other);
+      DecisionIDBitset& operator|=(const DecisionIDBitset& other);
+      bool operator==(const DecisionIDBitset& other) const { return m_words == other.m_words; }
+
+      /// Call f(i) for all set bits, in increasing order of i
+      template<typename F>
+      void forEach(F f) const {
+        for (size_t w = 0; w < m_words.size(); ++w) {
+          for (uint64_t word = m_words[w]; word != 0; word &= word - 1) {
+            f(w * 64 + CxxUtils::count_trailing_zeros(word));
+          }
+        }
+      }
+
+    private:
+      std::vector<uint64_t> m_words;
+  };
+
+
+  /**
+   * @class DecisionIDIndex
+   * @brief Maps a fixed set of DecisionIDs (e.g. the chains and chain-legs an algorithm is configured for)
+   * to a dense index, for the bitset representation of the IDs passed by Decision objects.
+   *
+   * The index is ordered by DecisionID, such that the vector of a Decision object (the persistent form)
+   * is derived in the same order as from a DecisionIDContainer. IDs not in the index are ignored when
+   * converting to bitsets, as no algorithm using the index is concerned by them.
+   * Build the index once (e.g. in initialize), it is immutable and may be shared between events.
+   **/
+  class DecisionIDIndex {
+    public:
+
+      /// Value of index() for IDs which are not indexed
+      static constexpr size_t npos = static_cast<size_t>(-1);
+
+      DecisionIDIndex() = default;
+      explicit DecisionIDIndex(const DecisionIDContainer& ids);
+
+      /// @return number of indexed IDs
+      size_t size() const { return m_ids.size(); }
+
+      /// @return the index of the ID, or npos if not indexed
+      size_t index(DecisionID id) const;
+
+      /// @return the ID at index i
+      DecisionID id(size_t i) const { return m_ids[i]; }
+
+      /// @return empty bitset of the size of this index
+      DecisionIDBitset bits() const { return DecisionIDBitset(m_ids.size()); }
+
+      /// @return bitset of the indexed IDs in the set
+      DecisionIDBitset bits(const DecisionIDContainer& ids) const;
+
+      /// @return bitset of the indexed IDs passed by the Decision object
+      DecisionIDBitset bits(const Decision* d) const;
+
+      /// @return the IDs of the set bits
+      DecisionIDContainer toSet(const DecisionIDBitset& bits) const;
+
+      /**
+       * @brief Add the IDs of the set bits to the Decision object.
+       * Same result as insertDecisionIDs(toSet(bits), dest), without the intermediate std::set.
+       **/
+      void insert(const DecisionIDBitset& bits, Decision* dest) const;
+
+    private:
+      std::vector<DecisionID> m_ids; //!< Sorted
+      std::unordered_map<DecisionID, size_t> m_index;
+  };
+
+}
+
+#endif // TrigCompositeUtils_DecisionIDBitset_h
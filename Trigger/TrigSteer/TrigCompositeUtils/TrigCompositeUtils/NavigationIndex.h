@@ -0,0 +1,113 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef TrigCompositeUtils_NavigationIndex_h
+#define TrigCompositeUtils_NavigationIndex_h
+
+#include "TrigCompositeUtils/TrigCompositeUtils.h"
+#include "TrigCompositeUtils/NavGraph.h"
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace TrigCompositeUtils {
+
+  /**
+   * @class NavigationIndex
+   * @brief Event-level index of the Decision objects of the full navigation graph.
+   *
+   * Every node is dereferenced only once, when it is first reached. The nodes are stored in a flat array,
+   * the seed (a.k.a. parent) links of each node as indices in one compressed array (CSR form) and the
+   * DecisionIDs of each node in a second one. Repeated navigation queries within the same event,
+   * e.g. TrigDecisionTool::features for many chains, then follow indices instead of ElementLinks.
+   *
+   * The index holds the graph above the terminus node given to the constructor and is immutable once built,
+   * such that it can be shared by concurrent queries. Start nodes which are not indexed (e.g. rejected decision
+   * nodes) are followed through their ElementLinks until an indexed node is reached.
+   * The object is only valid for the event it was built in.
+   **/
+  class NavigationIndex {
+    public:
+
+      /// Value of index() for nodes which are not indexed
+      static constexpr uint32_t npos = static_cast<uint32_t>(-1);
+
+      NavigationIndex() = default;
+
+      /**
+       * @brief Index the navigation graph reachable from the terminus node.
+       * @param[in] terminus The start node, typically the HLTPassRaw node of HLTNav_Summary.
+       **/
+      NavigationIndex(const Decision* terminus);
+
+      /**
+       * @brief Equivalent of recursiveGetDecisions, using the index.
+       * Fills the navGraph with the same nodes and edges, in the same order, as recursiveGetDecisions.
+       **/
+      void getDecisions(const Decision* start,
+        NavGraph& navGraph,
+        const EventContext& ctx,
+        const DecisionIDContainer& ids = {},
+        const bool enforceDecisionOnStartNode = true) const;
+
+      /// @return Index of the node, or npos if it is not indexed
+      uint32_t index(const Decision* node) const;
+
+      /// @return Number of indexed nodes
+      size_t size() const { return m_nodes.size(); }
+
+      /// @return The node with index i
+      const Decision* node(uint32_t i) const { return m_nodes[i]; }
+
+      /// @return Number of seeds of node i
+      uint32_t nSeeds(uint32_t i) const { return m_seedOffsets[i + 1] - m_seedOffsets[i]; }
+
+      /// @return Index of the n-th seed of node i
+      uint32_t seed(uint32_t i, uint32_t n) const { return m_seeds[m_seedOffsets[i] + n]; }
+
+      /// @return True if node i passes any of the required IDs. Same as TrigCompositeUtils::isAnyIDPassing.
+      bool isAnyIDPassing(uint32_t i, const DecisionIDContainer& required) const;
+
+    private:
+
+      /// Nodes fully explored in one getDecisions call, local to the call
+      struct Explored {
+        std::vector<bool> indexed; //!< by node index
+        std::set<const Decision*> other; //!< nodes which are not indexed
+      };
+
+      /// Index the node and all nodes above it
+      uint32_t add(const Decision* node);
+
+      /// Recursion of getDecisions over indexed nodes, see recursiveGetDecisionsInternal
+      void getDecisionsInternal(uint32_t node,
+        const Decision* comingFrom,
+        NavGraph& navGraph,
+        const EventContext& ctx,
+        Explored& explored,
+        const DecisionIDContainer& ids,
+        const bool enforceDecisionOnNode) const;
+
+      /// Recursion of getDecisions over nodes which are not indexed, switching to the index when reaching it
+      void getDecisionsInternal(const Decision* node,
+        const Decision* comingFrom,
+        NavGraph& navGraph,
+        const EventContext& ctx,
+        Explored& explored,
+        const DecisionIDContainer& ids,
+        const bool enforceDecisionOnNode) const;
+
+      std::vector<const Decision*> m_nodes;
+      std::unordered_map<const Decision*, uint32_t> m_nodeIndex;
+      std::vector<uint32_t> m_seedOffsets{0}; //!< seeds of node i are m_seeds[m_seedOffsets[i]] ... m_seeds[m_seedOffsets[i+1]-1]
+      std::vector<uint32_t> m_seeds;
+      std::vector<uint32_t> m_idOffsets{0}; //!< DecisionIDs of node i, same layout as the seeds
+      std::vector<DecisionID> m_ids;
+  };
+
+}
+
+#endif // TrigCompositeUtils_NavigationIndex_h
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include <iostream>
@@ -320,6 +320,66 @@ void nestedComb() {
 }
 
 
+void prunedComb() {
+  std::cout << "\npruned nested unique combinations" << std::endl;
+
+  // without filters, the same combinations as NestedUniqueCombinationGenerator, in the same order
+  NestedUniqueCombinationGenerator n;
+  n.add({4,2});
+  n.add({3,1});
+  n.add({3,2});
+  PrunedCombinationGenerator p;
+  p.add(4,2);
+  p.add(3,1);
+  p.add(3,2);
+  VALUE( p.size() ) EXPECTED( 5 );
+  size_t count = 0;
+  p.run( [&]( const std::vector<size_t>& c ) {
+    VALUE( c ) EXPECTED( n() );
+    ++n;
+    ++count;
+    return true;
+  } );
+  VALUE( count ) EXPECTED( 6*3*3 );
+  VALUE( bool(n) ) EXPECTED( false );
+  VALUE( p.pruned() ) EXPECTED( false );
+
+  // element 1 of the first collection is rejected, and element 0 of the second collection
+  // never combines with element 2 of the first one
+  p.setElementFilter( []( size_t coll, size_t el ) { return not ( coll == 0 and el == 1 ); } );
+  size_t pairCalls = 0;
+  p.setPairFilter( [&]( size_t collA, size_t elA, size_t collB, size_t elB ) {
+    ++pairCalls;
+    return not ( ( collA == 0 and elA == 2 and collB == 1 and elB == 0 ) or ( collA == 1 and elA == 0 and collB == 0 and elB == 2 ) );
+  } );
+  std::vector<std::vector<size_t>> pruned;
+  p.run( [&]( const std::vector<size_t>& c ) { pruned.push_back( c ); return true; } );
+  std::vector<std::vector<size_t>> expected;
+  NestedUniqueCombinationGenerator n2;
+  n2.add({4,2});
+  n2.add({3,1});
+  n2.add({3,2});
+  for ( ; n2; ++n2 ) {
+    const std::vector<size_t>& c = n2();
+    if ( c[0] == 1 or c[1] == 1 ) continue;
+    if ( ( c[0] == 2 or c[1] == 2 ) and c[2] == 0 ) continue;
+    expected.push_back( c );
+  }
+  VALUE( pruned.size() ) EXPECTED( expected.size() );
+  VALUE( pruned == expected ) EXPECTED( true );
+  VALUE( p.pruned() ) EXPECTED( true );
+  // each pair of elements is evaluated at most once
+  VALUE( pairCalls <= 10*9/2 ) EXPECTED( true );
+  std::cout << "pruned: " << expected.size() << " of " << count << " combinations, " << pairCalls << " pair filter calls" << std::endl;
+
+  // stop on request of the handle
+  count = 0;
+  const bool completed = p.run( [&]( const std::vector<size_t>& ) { return ++count < 3; } );
+  VALUE( completed ) EXPECTED( false );
+  VALUE( count ) EXPECTED( 3 );
+}
+
+
 int main() {
 
   smallCombination();
@@ -333,6 +393,7 @@ int main() {
   uniqueComb();
   
   nestedComb();
+  prunedComb();
   
   return 0;  
 }
@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include <iostream>
+#include "TestTools/expect.h"
+#include "TrigCompositeUtils/DecisionIDBitset.h"
+#include "xAODTrigger/TrigCompositeAuxContainer.h"
+
+int main() {
+  using namespace TrigCompositeUtils;
+
+  // More than one word of bits
+  DecisionIDContainer menu;
+  for ( DecisionID id = 1000; id < 1200; id += 2 ) menu.insert( id );
+  const DecisionIDIndex index( menu );
+  VALUE( index.size() ) EXPECTED( 100u );
+  VALUE( index.index( 1000 ) ) EXPECTED( 0u );
+  VALUE( index.index( 1198 ) ) EXPECTED( 99u );
+  VALUE( index.index( 1001 ) == DecisionIDIndex::npos ) EXPECTED( true );
+  VALUE( index.id( 70 ) ) EXPECTED( 1140u );
+
+  // IDs outside of the index are ignored
+  const DecisionIDContainer a{ 1000, 1100, 1198, 7 };
+  const DecisionIDContainer b{ 1100, 1198, 1150 };
+  DecisionIDBitset bitsA = index.bits( a );
+  const DecisionIDBitset bitsB = index.bits( b );
+  VALUE( bitsA.count() ) EXPECTED( 3u );
+  VALUE( bitsA.intersects( bitsB ) ) EXPECTED( true );
+  VALUE( index.bits().any() ) EXPECTED( false );
+
+  bitsA &= bitsB;
+  VALUE( index.toSet( bitsA ) == DecisionIDContainer({ 1100, 1198 }) ) EXPECTED( true );
+  bitsA |= index.bits( DecisionIDContainer{ 1002 } );
+  VALUE( index.toSet( bitsA ) == DecisionIDContainer({ 1002, 1100, 1198 }) ) EXPECTED( true );
+
+  // Same content and order of the persistent IDs as with insertDecisionIDs
+  DecisionContainer dc;
+  xAOD::TrigCompositeAuxContainer aux;
+  dc.setStore( &aux );
+  Decision* viaSet = newDecisionIn( &dc, "viaSet" );
+  Decision* viaBits = newDecisionIn( &dc, "viaBits" );
+  for ( Decision* d : { viaSet, viaBits } ) {
+    addDecisionID( 1198, d );
+    addDecisionID( 5, d );
+  }
+  insertDecisionIDs( index.toSet( bitsA ), viaSet );
+  index.insert( bitsA, viaBits );
+  VALUE( decisionIDs( viaBits ) == decisionIDs( viaSet ) ) EXPECTED( true );
+  VALUE( decisionIDs( viaBits ).size() ) EXPECTED( 4u );
+  VALUE( index.bits( viaBits ) == bitsA ) EXPECTED( true );
+
+  std::cout << "ok" << std::endl;
+  return 0;
+}
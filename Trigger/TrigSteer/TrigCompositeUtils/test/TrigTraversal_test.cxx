@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include <iostream>
@@ -13,6 +13,7 @@
 #include "TestTools/expect.h"
 #include "TestTools/expect_exception.h"
 #include "TrigCompositeUtils/TrigCompositeUtils.h"
+#include "TrigCompositeUtils/NavigationIndex.h"
 #include "xAODTrigger/TrigCompositeAuxContainer.h"
 #include "xAODTrigger/TrigCompositeContainer.h"
 #include "CxxUtils/checker_macros.h"
@@ -25,6 +26,18 @@
 template<class CONTAINER>
 void printFeatures(const std::vector< TrigCompositeUtils::LinkInfo<CONTAINER> >& featureContainer, const std::string& name, MsgStream& log);
 
+/// @brief Check that two graphs contain the same nodes, edges and final nodes
+bool sameGraph(const TrigCompositeUtils::NavGraph& a, const TrigCompositeUtils::NavGraph& b) {
+  if (a.nodes() != b.nodes() or a.edges() != b.edges()) return false;
+  const std::vector<TrigCompositeUtils::NavGraphNode*> aFinal = a.finalNodes();
+  const std::vector<TrigCompositeUtils::NavGraphNode*> bFinal = b.finalNodes();
+  if (aFinal.size() != bFinal.size()) return false;
+  for (size_t i = 0; i < aFinal.size(); ++i) {
+    if (aFinal[i]->node() != bFinal[i]->node()) return false;
+  }
+  return true;
+}
+
 /// @brief Test to check traversal functions of a graph of interconnect TrigComposite objects
 ///
 /// This test hard-codes a Run 3 navigation structure and tests that the correct 
@@ -344,6 +357,25 @@ int main ATLAS_NOT_THREAD_SAFE () {
   recursiveGetDecisions(END, graph_HLT_em_chain, ctx, {HLT_em_chain}, true);
   recursiveGetDecisions(END, graph_HLT_all, ctx, {}, true);
 
+  // The navigation index must give the same graphs, also when re-used for several chains
+  const NavigationIndex navIndex(END);
+  NavGraph index_HLT_mufast_chain;
+  NavGraph index_HLT_mu_chain;
+  NavGraph index_HLT_mu_em_chain;
+  NavGraph index_HLT_em_chain;
+  NavGraph index_HLT_all;
+  navIndex.getDecisions(END, index_HLT_mufast_chain, ctx, {HLT_mufast_chain}, true);
+  navIndex.getDecisions(END, index_HLT_mu_chain, ctx, {HLT_mu_chain}, true);
+  navIndex.getDecisions(END, index_HLT_mu_em_chain, ctx, {HLT_mu_em_chain}, true);
+  navIndex.getDecisions(END, index_HLT_em_chain, ctx, {HLT_em_chain}, true);
+  navIndex.getDecisions(END, index_HLT_all, ctx, {}, true);
+  VALUE( navIndex.index(END) ) EXPECTED( 0u );
+  VALUE( sameGraph(graph_HLT_mufast_chain, index_HLT_mufast_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_mu_chain, index_HLT_mu_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_mu_em_chain, index_HLT_mu_em_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_em_chain, index_HLT_em_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_all, index_HLT_all) ) EXPECTED( true );
+
 
   log << MSG::INFO << "HLT_mufast_chain" << endmsg;
   graph_HLT_mufast_chain.printAllPaths(log, MSG::INFO);
@@ -404,6 +436,30 @@ int main ATLAS_NOT_THREAD_SAFE () {
     recursiveGetDecisions(d, graph_HLT_all, ctx, {}, false);
   }
 
+  // Rejected nodes are not indexed, they are followed through their links until the indexed graph is reached
+  const size_t indexedNodes = navIndex.size();
+  for (const Decision* d : extraStart_HLT_mufast_chain) {
+    navIndex.getDecisions(d, index_HLT_mufast_chain, ctx, {HLT_mufast_chain}, false);
+  }
+  for (const Decision* d : extraStart_HLT_mu_chain) {
+    navIndex.getDecisions(d, index_HLT_mu_chain, ctx, {HLT_mu_chain}, false);
+  }
+  for (const Decision* d : extraStart_HLT_mu_em_chain) {
+    navIndex.getDecisions(d, index_HLT_mu_em_chain, ctx, {HLT_mu_em_chain}, false);
+  }
+  for (const Decision* d : extraStart_HLT_em_chain) {
+    navIndex.getDecisions(d, index_HLT_em_chain, ctx, {HLT_em_chain}, false);
+  }
+  for (const Decision* d : extraStart_HLT_all) {
+    navIndex.getDecisions(d, index_HLT_all, ctx, {}, false);
+  }
+  VALUE( navIndex.size() ) EXPECTED( indexedNodes );
+  VALUE( sameGraph(graph_HLT_mufast_chain, index_HLT_mufast_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_mu_chain, index_HLT_mu_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_mu_em_chain, index_HLT_mu_em_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_em_chain, index_HLT_em_chain) ) EXPECTED( true );
+  VALUE( sameGraph(graph_HLT_all, index_HLT_all) ) EXPECTED( true );
+
   log << MSG::INFO << "HLT_mufast_chain" << endmsg;
   graph_HLT_mufast_chain.printAllPaths(log, MSG::INFO);
   log << MSG::INFO << "HLT_mu_chain" << endmsg;
@@ -0,0 +1,66 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TriggerEDMCompression.h"
+
+#include "Compression.h"
+#include "RZip.h"
+
+#include <algorithm>
+
+namespace {
+  /// Largest block which can be compressed in one go by R__zip
+  constexpr size_t maxBlockSize = 0xffffff;
+  /// Size of the header preceding each ROOT compression block
+  constexpr size_t blockHeaderSize = 9;
+}
+
+namespace TriggerEDMCompression {
+
+  bool compress( const void* data, size_t size, int setting, std::vector<char>& output ) {
+    const auto algorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>( setting / 100 );
+    const int level = setting % 100;
+    if ( level <= 0 or size == 0 ) return false;
+
+    // Compressed data is useful only if smaller than the input
+    output.resize( size );
+    char* src = static_cast<char*>( const_cast<void*>(data) ); // R__zip does not modify the input
+    size_t inPos = 0;
+    size_t outPos = 0;
+    while ( inPos < size ) {
+      int srcSize = static_cast<int>( std::min( maxBlockSize, size - inPos ) );
+      int tgtSize = static_cast<int>( std::min( maxBlockSize, size - outPos ) );
+      int written = 0;
+      if ( tgtSize <= static_cast<int>( blockHeaderSize ) ) return false;
+      R__zipMultipleAlgorithm( level, &srcSize, src + inPos, &tgtSize, output.data() + outPos, &written, algorithm );
+      if ( written <= 0 ) return false; // incompressible or output buffer too small
+      inPos += srcSize;
+      outPos += written;
+    }
+    output.resize( outPos );
+    return true;
+  }
+
+  bool decompress( const void* data, size_t size, char* output, size_t outputSize ) {
+    unsigned char* src = static_cast<unsigned char*>( const_cast<void*>(data) ); // R__unzip does not modify the input
+    unsigned char* tgt = reinterpret_cast<unsigned char*>( output );
+    size_t inPos = 0;
+    size_t outPos = 0;
+    while ( inPos < size ) {
+      if ( size - inPos < blockHeaderSize ) return false;
+      int blockSize = 0;
+      int blockOutSize = 0;
+      if ( R__unzip_header( &blockSize, src + inPos, &blockOutSize ) != 0 ) return false;
+      if ( blockSize <= 0 or static_cast<size_t>( blockSize ) > size - inPos ) return false;
+      if ( blockOutSize <= 0 or static_cast<size_t>( blockOutSize ) > outputSize - outPos ) return false;
+      int read = 0;
+      R__unzip( &blockSize, src + inPos, &blockOutSize, tgt + outPos, &read );
+      if ( read != blockOutSize ) return false;
+      inPos += blockSize;
+      outPos += read;
+    }
+    return outPos == outputSize;
+  }
+
+}
@@ -0,0 +1,45 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+#ifndef TRIGOUTPUTHANDLING_TRIGGEREDMCOMPRESSION_H
+#define TRIGOUTPUTHANDLING_TRIGGEREDMCOMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Compression of the serialised collection payload in the HLT result
+ *
+ * A compressed payload replaces the [data payload in bytes][....data payload...] part of a fragment with
+ * [compressed size in bytes | CompressedFlag][uncompressed size in bytes][....compressed blocks....].
+ * The blocks are the standard ROOT compression blocks (each with its own header), so any algorithm supported
+ * by ROOT (ZLIB, LZMA, LZ4, ZSTD) can be used and is detected on decoding. Uncompressed payloads are unchanged,
+ * so results written without compression are read as before.
+ **/
+namespace TriggerEDMCompression {
+
+  /// Flag in the payload size word marking a compressed payload
+  constexpr uint32_t CompressedFlag = 0x80000000;
+
+  /// @return true if the payload size word flags a compressed payload
+  constexpr bool isCompressed( uint32_t sizeWord ) { return (sizeWord & CompressedFlag) != 0; }
+
+  /// @return the payload size in bytes, without the compression flag
+  constexpr uint32_t payloadSize( uint32_t sizeWord ) { return sizeWord & ~CompressedFlag; }
+
+  /**
+   * Compress the data with the ROOT compression setting (algorithm*100 + level, e.g. 404 for LZ4 level 4)
+   * @return false if the data cannot be compressed to less than its size, output is then undefined
+   **/
+  bool compress( const void* data, size_t size, int setting, std::vector<char>& output );
+
+  /**
+   * Decompress data written by @c compress into the output buffer of exactly @c outputSize bytes
+   * @return false if the data is corrupted or does not decompress to @c outputSize bytes
+   **/
+  bool decompress( const void* data, size_t size, char* output, size_t outputSize );
+
+}
+
+#endif // TRIGOUTPUTHANDLING_TRIGGEREDMCOMPRESSION_H
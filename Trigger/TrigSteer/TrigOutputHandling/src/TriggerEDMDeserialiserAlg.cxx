@@ -24,6 +24,7 @@
 
 #include "TriggerEDMDeserialiserAlg.h"
 #include "TriggerEDMCLIDs.h"
+#include "TriggerEDMCompression.h"
 
 #include "TFile.h"
 #include "TStreamerInfo.h"
@@ -161,12 +162,29 @@ namespace PayloadHelpers {
     return *( start + TDA::NameLengthOffset );
   }
 
+  /// Position of the payload size word in the next fragment
+  #if __cpp_lib_array_constexpr >= 201811L
+  constexpr
+  #endif
+  TDA::PayloadIterator sizeWord(TDA::PayloadIterator start) {
+    return start + TDA::NameOffset + nameLength(start);
+  }
+
+  /// Is the data content of the next fragment compressed
+  #if __cpp_lib_array_constexpr >= 201811L
+  constexpr
+  #endif
+  bool isCompressed(TDA::PayloadIterator start) {
+    return TriggerEDMCompression::isCompressed( *sizeWord(start) );
+  }
+
   /// Size in bytes of the buffer that is needed to decode next fragment data content
   #if __cpp_lib_array_constexpr >= 201811L
   constexpr
   #endif
   size_t dataSize(TDA::PayloadIterator start) {
-    return *( start + TDA::NameOffset + nameLength(start) );
+    // the uncompressed size follows the size word of compressed data
+    return isCompressed(start) ? *( sizeWord(start) + 1 ) : *sizeWord(start);
   }
 
   /**
@@ -189,12 +207,21 @@ namespace PayloadHelpers {
     return labels;
   }
 
-  /// Copies fragment to the buffer, no size checking, use @c dataSize to do so
-  void toBuffer(TDA::PayloadIterator start, char* buffer) {
+  /**
+   * Copies fragment to the buffer, decompressing it if needed. No size checking, use @c dataSize to do so
+   * @return false if compressed data cannot be decoded
+   **/
+  bool toBuffer(TDA::PayloadIterator start, char* buffer) {
+    if ( isCompressed(start) ) {
+      TDA::PayloadIterator dataStart = sizeWord(start) + 2 /*skip both sizes*/;
+      return TriggerEDMCompression::decompress( &(*dataStart), TriggerEDMCompression::payloadSize( *sizeWord(start) ),
+                                                buffer, dataSize(start) );
+    }
     // move to the beginning of the buffer memory
-    TDA::PayloadIterator dataStart =  start + TDA::NameOffset + nameLength(start) + 1 /*skip size*/;
+    TDA::PayloadIterator dataStart = sizeWord(start) + 1 /*skip size*/;
     // we rely on continuous memory layout of std::vector ...
     std::memcpy( buffer, &(*dataStart), dataSize(start) );
+    return true;
   }
 }
 
@@ -271,7 +298,10 @@ StatusCode TriggerEDMDeserialiserAlg::deserialise( const Payload* dataptr ) cons
                    " type: "<< transientTypeName << " (" << transientTypeInfoName << ")" <<
                    " persistent type: " << persistentTypeName << " key: " << key << " size: " << bsize );
     resize( bsize );
-    PayloadHelpers::toBuffer( start, buff.get() );
+    if ( not PayloadHelpers::toBuffer( start, buff.get() ) ) {
+      ATH_MSG_ERROR( "Decompression of the payload of " << persistentTypeName << "#" << key << " failed" );
+      return StatusCode::FAILURE;
+    }
 
     // point the start to the next chunk, irrespectively of what happens in deserialisation below
     start = PayloadHelpers::toNextFragment( start );
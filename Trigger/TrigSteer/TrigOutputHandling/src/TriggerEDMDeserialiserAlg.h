@@ -22,6 +22,8 @@
  * the [...] more words.
  * Format is as follows:
  * [fragment size in words][CLID][size of serialised collection name][...serialised collection name ...][data payload in bytes][....data payload...]
+ * If the payload is compressed, the top bit of the payload size word is set and the uncompressed size follows it:
+ * [...][compressed payload in bytes | 0x80000000][data payload in bytes][....compressed payload...]
  * It follows from the TrigEDMSerialiserTool implementation.
  **/
 
@@ -19,6 +19,7 @@
 
 #include "TriggerEDMSerialiserTool.h"
 #include "TriggerEDMCLIDs.h"
+#include "TriggerEDMCompression.h"
 
 #include <numeric>
 
@@ -38,6 +39,10 @@ StatusCode TriggerEDMSerialiserTool::initialize() {
   ATH_CHECK( m_clidSvc.retrieve() );
   ATH_CHECK( m_debugInfoWHKey.initialize() );
   if (!m_monTool.empty()) ATH_CHECK(m_monTool.retrieve());
+  if (m_compressionSetting < 0) {
+    ATH_MSG_ERROR("CompressionSetting cannot be negative, but is set to " << m_compressionSetting);
+    return StatusCode::FAILURE;
+  }
   // Parse the list of collections to serialise
   for ( const std::string& typeKeyAuxIDs : m_collectionsToSerialize.value() ) {
     ATH_CHECK(addCollectionToSerialise(typeKeyAuxIDs, m_toSerialise));
@@ -179,6 +184,22 @@ StatusCode TriggerEDMSerialiserTool::makeHeader(const Address& address, std::vec
 StatusCode TriggerEDMSerialiserTool::fillPayload( const void* data, size_t sz, std::vector<uint32_t>& buffer ) const {
   ATH_CHECK( sz != 0 );
   ATH_CHECK( data != nullptr );
+  ATH_CHECK( TriggerEDMCompression::payloadSize( sz ) == sz ); // the top bit flags compressed payload
+
+  if ( m_compressionSetting > 0 and sz >= m_compressionMinSize ) {
+    std::vector<char> compressed;
+    if ( TriggerEDMCompression::compress( data, sz, m_compressionSetting, compressed ) ) {
+      ATH_MSG_DEBUG( "Compressed payload from " << sz << " to " << compressed.size() << " bytes" );
+      buffer.push_back( compressed.size() | TriggerEDMCompression::CompressedFlag ); // size in bytes
+      buffer.push_back( sz ); // size in bytes after decompression
+      const size_t neededSize = std::ceil( double(compressed.size())/sizeof(uint32_t) );
+      const size_t existingSize = buffer.size();
+      buffer.resize(existingSize + neededSize);
+      std::memcpy(buffer.data() + existingSize, compressed.data(), compressed.size());
+      return StatusCode::SUCCESS;
+    }
+    ATH_MSG_VERBOSE( "Payload of " << sz << " bytes not compressible, storing it uncompressed" );
+  }
 
   buffer.push_back( sz ); // size in bytes
   const size_t neededSize = std::ceil( double(sz)/sizeof(uint32_t) );
@@ -61,6 +61,14 @@ class TriggerEDMSerialiserTool: public extends<AthAlgTool, HLTResultMTMakerTool>
   Gaudi::Property<bool> m_saveDynamic {
     this, "SaveDynamic", true, "If false skips serialising of dynamic variables. Use for test purpose only."
   };
+  Gaudi::Property<int> m_compressionSetting {
+    this, "CompressionSetting", 0,
+    "ROOT compression setting (algorithm*100 + level, e.g. 404 for LZ4 level 4 or 505 for ZSTD level 5) applied to "
+    "the serialised payload of each collection and dynamic variable. 0 means no compression."
+  };
+  Gaudi::Property<uint32_t> m_compressionMinSize {
+    this, "CompressionMinSize", 512, "Payloads smaller than this size in bytes are not compressed"
+  };
   Gaudi::Property<std::map<uint16_t,uint32_t>> m_truncationThresholds {
     this, "TruncationThresholds", {}, "HLT result truncation thresholds. Key is module ID, value is max size in bytes"
   };
@@ -135,6 +143,7 @@ class TriggerEDMSerialiserTool: public extends<AthAlgTool, HLTResultMTMakerTool>
 
   /**
    * Copy bytes from the memory into the buffer converting from char[] to uint32_t[]
+   * The bytes are compressed first if CompressionSetting is set and the compressed payload is smaller
    * This function is candidate to be made global function at some point
    * and we will need also readPayload function
    */
@@ -0,0 +1,57 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+#include <iostream>
+#include <vector>
+#include "TestTools/expect.h"
+#include "../src/TriggerEDMCompression.h"
+
+
+void testRoundTrip( const std::vector<char>& data, int setting ) {
+  std::vector<char> compressed;
+  VALUE( TriggerEDMCompression::compress( data.data(), data.size(), setting, compressed ) ) EXPECTED( true );
+  VALUE( compressed.size() < data.size() ) EXPECTED( true );
+  VALUE( TriggerEDMCompression::isCompressed( compressed.size() | TriggerEDMCompression::CompressedFlag ) ) EXPECTED( true );
+
+  std::vector<char> decompressed( data.size() );
+  VALUE( TriggerEDMCompression::decompress( compressed.data(), compressed.size(),
+                                            decompressed.data(), decompressed.size() ) ) EXPECTED( true );
+  VALUE( decompressed == data ) EXPECTED( true );
+
+  // wrong expected size or truncated input must be detected
+  VALUE( TriggerEDMCompression::decompress( compressed.data(), compressed.size(),
+                                            decompressed.data(), decompressed.size() - 1 ) ) EXPECTED( false );
+  VALUE( TriggerEDMCompression::decompress( compressed.data(), compressed.size() / 2,
+                                            decompressed.data(), decompressed.size() ) ) EXPECTED( false );
+  std::cout << "setting " << setting << ": " << data.size() << " -> " << compressed.size() << " bytes" << std::endl;
+}
+
+
+int main() {
+  // typical float aux variable content: many repeated and similar values
+  std::vector<float> values;
+  for ( size_t i = 0; i < 10000; ++i ) values.push_back( i % 10 == 0 ? -999.f : 0.5f * (i % 50) );
+  const char* bytes = reinterpret_cast<const char*>( values.data() );
+  const std::vector<char> data( bytes, bytes + values.size() * sizeof(float) );
+
+  testRoundTrip( data, 101 );  // ZLIB
+  testRoundTrip( data, 404 );  // LZ4
+  testRoundTrip( data, 505 );  // ZSTD
+
+  // more than one ROOT compression block
+  std::vector<char> large;
+  while ( large.size() <= 0xffffff ) large.insert( large.end(), data.begin(), data.end() );
+  testRoundTrip( large, 404 );
+
+  // no compression requested or nothing to gain
+  std::vector<char> compressed;
+  VALUE( TriggerEDMCompression::compress( data.data(), data.size(), 0, compressed ) ) EXPECTED( false );
+  const std::vector<char> tiny{ 'a', 'b', 'c' };
+  VALUE( TriggerEDMCompression::compress( tiny.data(), tiny.size(), 404, compressed ) ) EXPECTED( false );
+
+  VALUE( TriggerEDMCompression::payloadSize( 1234 | TriggerEDMCompression::CompressedFlag ) ) EXPECTED( 1234u );
+  VALUE( TriggerEDMCompression::isCompressed( 1234 ) ) EXPECTED( false );
+
+  std::cout << "ok" << std::endl;
+  return 0;
+}
@@ -1,7 +1,7 @@
 /*
   General-purpose view creation algorithm <bwynne@cern.ch>
   
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "EventViewCreatorAlgorithm.h"
@@ -9,6 +9,7 @@
 #include "AthViews/ViewHelper.h"
 #include "AthViews/View.h"
 #include "TrigCompositeUtils/TrigCompositeUtils.h"
+#include "AthenaMonitoringKernel/Monitored.h"
 
 #include <sstream>
 
@@ -24,6 +25,7 @@ StatusCode EventViewCreatorAlgorithm::initialize() {
   ATH_CHECK( m_viewsKey.initialize() );
   ATH_CHECK( m_inViewRoIs.initialize() );
   ATH_CHECK( m_roiTool.retrieve() );
+  if (not m_monTool.empty()) ATH_CHECK( m_monTool.retrieve() );
   ATH_CHECK( m_cachedViewsKey.initialize(SG::AllowEmpty) );
   if (not m_cachedViewsKey.empty()) {
     renounce(m_cachedViewsKey); // Reading in and using cached inputs is optional, not guarenteed to be produced in every event.
@@ -55,9 +57,11 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
   ATH_MSG_DEBUG("Merging complete");
 
   // make the views
+  auto monTimeCreation = Monitored::Timer<std::chrono::duration<float, std::milli>>("TIME_viewCreation");
   auto viewsHandle = SG::makeHandle( m_viewsKey, context ); 
   ATH_CHECK( viewsHandle.record( std::make_unique<ViewContainer>() ) );
   auto viewVector = viewsHandle.ptr();
+  viewVector->reserve( outputHandle->size() ); // at most one view per output decision
 
   // Check for an optional input handle to use as a source of cached, already-executed, views.
   const DecisionContainer* cachedViews = nullptr;
@@ -74,6 +78,7 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
   // Keep track of the ROIs we spawn a View for, do not spawn duplicates.
   // For many cases, this will be covered by the Merging operation preceding this.
   std::vector<ElementLink<TrigRoiDescriptorCollection>> RoIsFromDecision;
+  RoIsFromDecision.reserve( outputHandle->size() );
 
   if( outputHandle->size() == 0) {
     ATH_MSG_DEBUG( "Have no decisions in output handle "<< outputHandle.key() << ". Handle is valid but container is empty. "
@@ -85,13 +90,16 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
   // Find and link to the output Decision objects the ROIs to run over
   ATH_CHECK( m_roiTool->attachROILinks(*outputHandle, context) );
 
+  // The ROI on which the views are spawned, by default the 'roi' of the Decision object
+  const std::string& viewRoILink = m_viewRoILink.empty() ? roiString() : m_viewRoILink.value();
+
   for ( Decision* outputDecision : *outputHandle ) { 
 
-    if (!outputDecision->hasObjectLink(roiString(), ClassID_traits<TrigRoiDescriptorCollection>::ID())) {
-      ATH_MSG_ERROR("No '" << roiString() << "'link was attached by the ROITool. Decision object dump:" << *outputDecision);
+    if (!outputDecision->hasObjectLink(viewRoILink, ClassID_traits<TrigRoiDescriptorCollection>::ID())) {
+      ATH_MSG_ERROR("No '" << viewRoILink << "'link was attached by the ROITool. Decision object dump:" << *outputDecision);
       return StatusCode::FAILURE;
     }
-    const ElementLink<TrigRoiDescriptorCollection> roiEL = outputDecision->objectLink<TrigRoiDescriptorCollection>(roiString());
+    const ElementLink<TrigRoiDescriptorCollection> roiEL = outputDecision->objectLink<TrigRoiDescriptorCollection>(viewRoILink);
     ATH_CHECK(roiEL.isValid());
 
     // We do one of three things here, either... 
@@ -111,13 +119,15 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
       // Re-use an already processed view from a previously executed EVCA instance
       const Decision* cached = cachedViews->at(cachedIndex);
       ElementLink<ViewContainer> cachedViewEL = cached->objectLink<ViewContainer>(viewString());
-      ElementLink<TrigRoiDescriptorCollection> cachedROIEL = cached->objectLink<TrigRoiDescriptorCollection>(roiString());
+      // The cached EVCA may spawn its views on the 'roi' link, e.g. if it does not merge ROIs
+      const std::string& cachedViewRoILink = cached->hasObjectLink(viewRoILink, ClassID_traits<TrigRoiDescriptorCollection>::ID()) ? viewRoILink : roiString();
+      ElementLink<TrigRoiDescriptorCollection> cachedROIEL = cached->objectLink<TrigRoiDescriptorCollection>(cachedViewRoILink);
       ATH_CHECK(cachedViewEL.isValid());
       ATH_CHECK(cachedROIEL.isValid());
       ATH_MSG_DEBUG("Re-using cached existing view from " << cachedViewEL.dataID() << ", index:" << cachedViewEL.index() 
         << " on ROI " << **cachedROIEL);
       outputDecision->setObjectLink( viewString(), cachedViewEL );
-      outputDecision->setObjectLink( roiString(), cachedROIEL );
+      outputDecision->setObjectLink( viewRoILink, cachedROIEL );
       // Note: This overwrites the link created in the above tool with what should be a spatially identical ROI (check?)
 
     } else if ( roiIt == RoIsFromDecision.end() ) {
@@ -125,7 +135,8 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
       // We have not yet spawned an ROI on this View. Do it now.
       RoIsFromDecision.push_back(roiEL);
       ATH_MSG_DEBUG("Found RoI:" << **roiEL << " FS=" << (*roiEL)->isFullscan() << ". Making View.");
-      SG::View* newView = ViewHelper::makeView( name()+"_view", viewVector->size() /*view counter*/, m_viewFallThrough );
+      // The views share the already retrieved event store handle of this algorithm
+      SG::View* newView = ViewHelper::makeView( name()+"_view", viewVector->size() /*view counter*/, m_viewFallThrough, evtStore() );
       viewVector->push_back( newView );
       // Use a fall-through filter if one is provided
       if ( m_viewFallFilter.size() ) {
@@ -163,14 +174,21 @@ StatusCode EventViewCreatorAlgorithm::execute( const EventContext& context ) con
     }
   } // loop over output decisions   
 
+  monTimeCreation.stop();
+
   // launch view execution
   ATH_MSG_DEBUG( "Launching execution in " << viewVector->size() << " unique views" );
+  auto monTimeScheduling = Monitored::Timer<std::chrono::duration<float, std::milli>>("TIME_viewScheduling");
   ATH_CHECK( ViewHelper::scheduleViews( viewVector, // Vector containing views
     m_viewNodeName,                                 // CF node to attach views to
     context,                                        // Source context
     getScheduler(),                                 // Scheduler to launch with
     m_reverseViews ) );                             // Debug option
-  
+  monTimeScheduling.stop();
+
+  auto monNViews = Monitored::Scalar<int>("nViews", viewVector->size());
+  Monitored::Group(m_monTool, monTimeCreation, monTimeScheduling, monNViews);
+
   return StatusCode::SUCCESS;
 }
 
@@ -1,7 +1,7 @@
 /*
   General-purpose view creation algorithm <bwynne@cern.ch>
 
-  Copyright (C) 2002-2018 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ViewAlgs_EventViewCreatorAlgorithm_h
@@ -20,6 +20,7 @@
 #include "GaudiKernel/IAlgResourcePool.h"
 #include "GaudiKernel/IScheduler.h"
 #include "AthViews/View.h"
+#include "AthenaMonitoringKernel/GenericMonitoringTool.h"
 
 #include "DecisionHandling/IViewCreatorROITool.h"
 
@@ -80,6 +81,12 @@ class EventViewCreatorAlgorithm : public ::InputMakerBase
     ToolHandle<IViewCreatorROITool> m_roiTool{this, "RoITool", "",
       "Tool used to supply per-Decision Object the RoI on which the Decision Object's view is to be spawned"};
 
+    Gaudi::Property< std::string > m_viewRoILink { this, "ViewRoILink", "",
+      "Name of the link to the ROI on which the views are spawned, if not the 'roi' link. E.g. the super-ROI of ViewCreatorMergedSuperROITool" };
+
+    ToolHandle<GenericMonitoringTool> m_monTool{ this, "MonTool", "",
+      "Optional monitoring of the time spent in creating and scheduling the views" };
+
     /// @name Muon slice code
     /// @{
     Gaudi::Property< bool > m_placeMuonInView { this, "PlaceMuonInView", false, 
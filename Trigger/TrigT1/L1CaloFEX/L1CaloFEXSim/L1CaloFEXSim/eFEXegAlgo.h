@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 //***************************************************************************
@@ -58,6 +58,25 @@ namespace LVL1 {
     virtual unsigned int getSeed() override {return m_seedID;};
     virtual void getCoreEMTowerET(unsigned int & et) override;
     virtual void getCoreHADTowerET(unsigned int & et) override;
+
+    /** Cell ETs of the 3x3 tower window: [eta][phi], 4 cells per tower in eta in layers 1 and 2 */
+    struct WindowCells {
+      unsigned int em0[3][3];
+      unsigned int em1[12][3];
+      unsigned int em2[12][3];
+      unsigned int em3[3][3];
+      unsigned int had[3][3];
+    };
+
+    /** Fill the cell ETs of the window of towers towerID[phi][eta]; towers outside of the eFEX coverage are zero */
+    static void buildLayers(const eTowerContainer & towers, const int towerID[3][3], int efex_id, int fpga_id, int central_eta, WindowCells & cells);
+
+    /** ET of a cell of the window, SCID being the layer 1/2 cell index relative to the central tower */
+    static unsigned int windowET(const WindowCells & cells, int layer, int jPhi, int SCID);
+
+    /** EM and hadronic sums of Rhad around a seed */
+    static void rhadSums(const WindowCells & cells, unsigned int seedID, std::vector<unsigned int> & rhadvec);
+
   private:
     void setSeed();
     bool m_seed_UnD = false; 
@@ -68,6 +87,9 @@ namespace LVL1 {
     int m_central_eta;
     bool m_hasSeed;
 
+    // Cell ETs of the 3x3 tower window, filled once in setup
+    WindowCells m_cells;
+
     SG::ReadHandleKey<LVL1::eTowerContainer> m_eTowerContainerKey {this, "MyETowers", "eTowerContainer", "Input container for eTowers"};
 
   };
@@ -1,5 +1,5 @@
 /*
- Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+ Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 //***************************************************************************
 //              jFEXSmallRJetAlgo - Algorithm for small R jet Algorithm in jFEX
@@ -52,6 +52,9 @@ namespace LVL1 {
     virtual std::unique_ptr<jFEXSmallRJetTOB> getSmallRJetTOBs() override;
     virtual unsigned int getTTIDcentre() override;
     virtual void setFPGAEnergy(std::unordered_map<int,std::vector<int> > et_map)  override;
+
+    /** Sum of the tower ETs of the 7x7 search window within DeltaR^2 < 16 (in units of towers) of the central tower */
+    static int smallClusterET(const int towerET[7][7]);
   //  virtual jFEXSmallRJetTOB* getSmallRJetTOBs() override;
 //LVL1::jFEXSmallRJetAlgoTOB * LVL1::jFEXSmallRJetAlgo::getSmallRJetTOB()
     
@@ -60,6 +63,7 @@ protected:
   private:
         SG::ReadHandleKey<LVL1::jTowerContainer> m_jTowerContainerKey {this, "MyjTowers", "jTowerContainer", "Input container for jTowers"};
         int m_jFEXalgoTowerID[7][7];
+        int m_jFEXalgoTowerET[7][7]; //!< ET of the towers of the search window, filled once in setup
         int m_jFEXalgoSearchWindowSeedET[5][5];
 	bool m_seedSet;
         bool m_LMDisplaced;
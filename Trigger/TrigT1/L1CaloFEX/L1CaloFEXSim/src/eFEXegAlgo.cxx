@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 //***************************************************************************
@@ -65,10 +65,40 @@ void eFEXegAlgo::setup(int inputTable[3][3], int efex_id, int fpga_id, int centr
   m_fpgaid = fpga_id; 
   m_central_eta = central_eta;
   
+  SG::ReadHandle<eTowerContainer> eTowerContainer(m_eTowerContainerKey/*,ctx*/);
+  buildLayers(*eTowerContainer, m_eFEXegAlgoTowerID, m_efexid, m_fpgaid, m_central_eta, m_cells);
   setSeed();
 
 }
 
+// Build arrays holding the cell ETs of each layer, such that the window sums do not look up towers
+void eFEXegAlgo::buildLayers(const eTowerContainer & towers, const int towerID[3][3], int efex_id, int fpga_id, int central_eta, WindowCells & cells) {
+
+  for (unsigned int ieta = 0; ieta < 3; ieta++) {
+    for (unsigned int iphi = 0; iphi < 3; iphi++) {
+      if (((efex_id%3 == 0) && (fpga_id == 0) && (central_eta == 0) && (ieta == 0)) || ((efex_id%3 == 2) && (fpga_id == 3) && (central_eta == 5) && (ieta == 2))) {
+        cells.em0[ieta][iphi] = 0;
+        cells.em3[ieta][iphi] = 0;
+        cells.had[ieta][iphi] = 0;
+        for (unsigned int i = 0; i < 4; i++) {
+          cells.em1[4 * ieta + i][iphi] = 0;
+          cells.em2[4 * ieta + i][iphi] = 0;
+        }
+      } else {
+        const LVL1::eTower * tmpTower = towers.findTower(towerID[iphi][ieta]);
+        cells.em0[ieta][iphi] = tmpTower->getLayerTotalET(0);
+        cells.em3[ieta][iphi] = tmpTower->getLayerTotalET(3);
+        cells.had[ieta][iphi] = tmpTower->getLayerTotalET(4);
+        for (unsigned int i = 0; i < 4; i++) {
+          cells.em1[4 * ieta + i][iphi] = tmpTower->getET(1, i);
+          cells.em2[4 * ieta + i][iphi] = tmpTower->getET(2, i);
+        }
+      }
+    }
+  }
+
+}
+
 void LVL1::eFEXegAlgo::getCoreEMTowerET(unsigned int & et) { 
 
   SG::ReadHandle<eTowerContainer> eTowerContainer(m_eTowerContainerKey/*,ctx*/);
@@ -148,27 +178,26 @@ void eFEXegAlgo::getReta(std::vector<unsigned int> & retavec) {
 
 void eFEXegAlgo::getRhad(std::vector<unsigned int> & rhadvec) {
 
+  rhadSums(m_cells, m_seedID, rhadvec);
+
+}
+
+void eFEXegAlgo::rhadSums(const WindowCells & cells, unsigned int seedID, std::vector<unsigned int> & rhadvec) {
+
   unsigned int hadsum = 0; // 3x3 Towers Had 
   unsigned int emsum = 0;  // (1x3 + 3x3 + 3x3 + 1x3) SCs EM
 
   rhadvec.clear();   // clear the output vector before starting
   
-  int iCoreStart  = m_seedID-1;
-  int iCoreEnd    = m_seedID+1;
+  int iCoreStart  = seedID-1;
+  int iCoreEnd    = seedID+1;
 
-  SG::ReadHandle<eTowerContainer> eTowerContainer(m_eTowerContainerKey/*,ctx*/);
-  
   // 3x3 Towers Had ; 1x3 L0 + 1x3 L3 EM
   for (int i=0; i<3; ++i) { // phi
     for (int j=0; j<=2; ++j) { // eta
-      if (((m_efexid%3 == 0) && (m_fpgaid == 0) && (m_central_eta == 0) && (j == 0)) || ((m_efexid%3 == 2) && (m_fpgaid == 3) && (m_central_eta == 5) && (j == 2))) {
-        continue;
-      } else { 
-        const eTower * tTower = eTowerContainer->findTower(m_eFEXegAlgoTowerID[i][j]);
-        hadsum += tTower->getLayerTotalET(4);
-        if (j==1) {
-	      emsum += ( tTower->getLayerTotalET(0) + tTower->getLayerTotalET(3) );
-        }
+      hadsum += cells.had[j][i];
+      if (j==1) {
+        emsum += ( cells.em0[j][i] + cells.em3[j][i] );
       }
     }
   }
@@ -176,10 +205,7 @@ void eFEXegAlgo::getRhad(std::vector<unsigned int> & rhadvec) {
   // 3x3 SCs L1 and L2 sum
   for (int i=iCoreStart; i<=iCoreEnd; ++i) { // eta
     for(int j=0; j<=2; ++j) { // phi
-      unsigned int tmp_et_a, tmp_et_b;
-      getWindowET(1,j,i,tmp_et_a);
-      getWindowET(2,j,i,tmp_et_b);
-      emsum += ( tmp_et_a + tmp_et_b );
+      emsum += ( windowET(cells,1,j,i) + windowET(cells,2,j,i) );
     }
   }   
   
@@ -283,40 +309,26 @@ std::unique_ptr<eFEXegTOB> LVL1::eFEXegAlgo::geteFEXegTOB() {
 
 void LVL1::eFEXegAlgo::getWindowET(int layer, int jPhi, int SCID, unsigned int & outET) {
 
-  SG::ReadHandle<eTowerContainer> eTowerContainer(m_eTowerContainerKey/*,ctx*/);
+  outET = windowET(m_cells, layer, jPhi, SCID);
 
-  if (SCID<0) { // left towers in eta
-    if ((m_efexid%3 == 0) && (m_fpgaid == 0) && (m_central_eta == 0)) { 
-      outET = 0;
-    } else {
-      int etaID = 4+SCID;
-      const eTower * tmpTower = eTowerContainer->findTower(m_eFEXegAlgoTowerID[jPhi][0]);
-      if (layer==1 || layer==2) {
-        outET = tmpTower->getET(layer,etaID);
-      } else if (layer==0 || layer==3 || layer==4) {
-        outET = tmpTower->getLayerTotalET(layer);
-      }
-    }
-  } else if (SCID>=0 && SCID<4) { // central towers in eta
-    const eTower * tmpTower = eTowerContainer->findTower(m_eFEXegAlgoTowerID[jPhi][1]);
-    if (layer==1 || layer==2) { 
-      outET = tmpTower->getET(layer,SCID);
-    } else if (layer==0 || layer==3 || layer==4) {
-      outET = tmpTower->getLayerTotalET(layer);
-    }
-  } else if (SCID>=4){ // right towers in eta
-    if ((m_efexid%3 == 2) && (m_fpgaid == 3) && (m_central_eta == 5)) {
-      outET = 0;
-    } else {
-      int etaID = SCID-4;
-      const eTower * tmpTower = eTowerContainer->findTower(m_eFEXegAlgoTowerID[jPhi][2]);
-      if (layer==1 || layer==2) {  
-        outET = tmpTower->getET(layer,etaID);
-      } else if (layer==0 || layer==3 || layer==4) {
-        outET = tmpTower->getLayerTotalET(layer);
-      }
-    }
+}
+
+unsigned int LVL1::eFEXegAlgo::windowET(const WindowCells & cells, int layer, int jPhi, int SCID) {
+
+  // Towers outside of the eFEX coverage are zero in the arrays
+  const int iTower = (SCID < 0) ? 0 : (SCID < 4 ? 1 : 2);
+  if (layer==1) {
+    return cells.em1[SCID+4][jPhi];
+  } else if (layer==2) {
+    return cells.em2[SCID+4][jPhi];
+  } else if (layer==0) {
+    return cells.em0[iTower][jPhi];
+  } else if (layer==3) {
+    return cells.em3[iTower][jPhi];
+  } else if (layer==4) {
+    return cells.had[iTower][jPhi];
   }
+  return 0;
 
 }
   
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration  
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration  
 */
 //***************************************************************************  
 //		jFEXSmallRJetAlgo - Algorithm for small R jet Algorithm in jFEX
@@ -57,6 +57,13 @@ StatusCode LVL1::jFEXSmallRJetAlgo::safetyTest(){
 void LVL1::jFEXSmallRJetAlgo::setup(int inputTable[7][7]) {
 
   std::copy(&inputTable[0][0], &inputTable[0][0] + 49, &m_jFEXalgoTowerID[0][0]);
+
+  // Look up the tower ETs once, the window sums below then run over this array
+  for(int iphi = 0; iphi < 7; iphi++) {
+    for(int ieta = 0; ieta < 7; ieta++) {
+      m_jFEXalgoTowerET[iphi][ieta] = getTTowerET(m_jFEXalgoTowerID[iphi][ieta]);
+    }
+  }
 }
 
 
@@ -73,8 +80,9 @@ unsigned int LVL1::jFEXSmallRJetAlgo::getTTowerET(unsigned int TTID ) {
         return 0;
     } 
     
-    if(m_map_Etvalues.find(TTID) != m_map_Etvalues.end()) {
-       return m_map_Etvalues[TTID][0];
+    const auto it = m_map_Etvalues.find(TTID);
+    if(it != m_map_Etvalues.end()) {
+       return it->second[0];
     }
     
     //we shouldn't arrive here
@@ -110,23 +118,21 @@ void LVL1::jFEXSmallRJetAlgo::buildSeeds()
 
     m_seedSet = false;
     m_LMDisplaced = false;
+
+    // The 3x3 seed sums as a separable sliding window: sums over eta first, then over phi
+    int etaSums[7][5];
+    for(int mphi = 0; mphi < 7; mphi++) {
+        for(int meta = 1; meta < 6; meta++) {
+            etaSums[mphi][meta - 1] = m_jFEXalgoTowerET[mphi][meta - 1] + m_jFEXalgoTowerET[mphi][meta] + m_jFEXalgoTowerET[mphi][meta + 1];
+        }
+    }
     for(int mphi = 1; mphi < 6; mphi++) {
-        for(int meta = 1; meta< 6; meta++) {
-            int et_tmp = 0;
-            int seedTotalET = 0;
-            for(int iphi = -1; iphi < 2; iphi++) {
-                for(int ieta = -1; ieta < 2; ieta++) {
-                    //for that TT, build the seed
-                    //here we sum TT ET to calculate seed
-                    et_tmp = getTTowerET(m_jFEXalgoTowerID[mphi + iphi][meta + ieta]);
-                    seedTotalET += et_tmp;
-                }
-            }
-            m_jFEXalgoSearchWindowSeedET[mphi -1][meta -1] = seedTotalET;
+        for(int meta = 0; meta < 5; meta++) {
+            m_jFEXalgoSearchWindowSeedET[mphi - 1][meta] = etaSums[mphi - 1][meta] + etaSums[mphi][meta] + etaSums[mphi + 1][meta];
         }
     }
 
-    int centralTT_ET = getTTowerET(m_jFEXalgoTowerID[3][3]);
+    int centralTT_ET = m_jFEXalgoTowerET[3][3];
     if(centralTT_ET==m_jFEXalgoSearchWindowSeedET[3][3]) {
         m_LMDisplaced = true;
     }
@@ -180,15 +186,32 @@ bool LVL1::jFEXSmallRJetAlgo::checkDisplacedLM()
 
 //in this clustering func, the central TT in jet is the parameters
 unsigned int LVL1::jFEXSmallRJetAlgo::getSmallClusterET() {
+    return smallClusterET(m_jFEXalgoTowerET);
+}
+
+
+namespace {
+  // Towers within DeltaR^2 < 16 of the central one, in units of towers
+  struct SmallClusterMask {
+    bool inCluster[7][7] = {};
+    constexpr SmallClusterMask() {
+      for(int nphi = -3; nphi < 4; nphi++) {
+        for(int neta = -3; neta < 4; neta++) {
+          inCluster[3+nphi][3+neta] = nphi*nphi + neta*neta < 16;
+        }
+      }
+    }
+  };
+  constexpr SmallClusterMask smallClusterMask;
+}
+
+
+int LVL1::jFEXSmallRJetAlgo::smallClusterET(const int towerET[7][7]) {
 
     int SRJetClusterET = 0;
-    for(int nphi = -3; nphi< 4; nphi++) {
-        for(int neta = -3; neta< 4; neta++) {
-            
-            int DeltaRSquared = std::pow(nphi,2)+std::pow(neta,2);
-            if(DeltaRSquared < 16) {
-                SRJetClusterET += getTTowerET(m_jFEXalgoTowerID[3+nphi][3+neta]);
-            }
+    for(int nphi = 0; nphi < 7; nphi++) {
+        for(int neta = 0; neta < 7; neta++) {
+            SRJetClusterET += smallClusterMask.inCluster[nphi][neta] * towerET[nphi][neta];
         }
     }
     return SRJetClusterET;
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+ */
+/**
+ * @file L1CaloFEXSim/test/eFEXegAlgo_test.cxx
+ * @brief Unit tests for the eFEX egamma window cell arrays.
+ */
+
+
+#undef NDEBUG
+#include "L1CaloFEXSim/eFEXegAlgo.h"
+#include "L1CaloFEXSim/eTowerContainer.h"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// Window cell ET as originally written, looking up the tower in the container for every cell
+unsigned int referenceWindowET(const LVL1::eTowerContainer& towers, const int towerID[3][3],
+                               int efex_id, int fpga_id, int central_eta,
+                               int layer, int jPhi, int SCID)
+{
+  unsigned int outET = 0;
+  if (SCID<0) { // left towers in eta
+    if ((efex_id%3 == 0) && (fpga_id == 0) && (central_eta == 0)) {
+      outET = 0;
+    } else {
+      int etaID = 4+SCID;
+      const LVL1::eTower * tmpTower = towers.findTower(towerID[jPhi][0]);
+      if (layer==1 || layer==2) {
+        outET = tmpTower->getET(layer,etaID);
+      } else if (layer==0 || layer==3 || layer==4) {
+        outET = tmpTower->getLayerTotalET(layer);
+      }
+    }
+  } else if (SCID>=0 && SCID<4) { // central towers in eta
+    const LVL1::eTower * tmpTower = towers.findTower(towerID[jPhi][1]);
+    if (layer==1 || layer==2) {
+      outET = tmpTower->getET(layer,SCID);
+    } else if (layer==0 || layer==3 || layer==4) {
+      outET = tmpTower->getLayerTotalET(layer);
+    }
+  } else if (SCID>=4){ // right towers in eta
+    if ((efex_id%3 == 2) && (fpga_id == 3) && (central_eta == 5)) {
+      outET = 0;
+    } else {
+      int etaID = SCID-4;
+      const LVL1::eTower * tmpTower = towers.findTower(towerID[jPhi][2]);
+      if (layer==1 || layer==2) {
+        outET = tmpTower->getET(layer,etaID);
+      } else if (layer==0 || layer==3 || layer==4) {
+        outET = tmpTower->getLayerTotalET(layer);
+      }
+    }
+  }
+  return outET;
+}
+
+
+// Rhad sums as originally written
+std::vector<unsigned int> referenceRhad(const LVL1::eTowerContainer& towers, const int towerID[3][3],
+                                        int efex_id, int fpga_id, int central_eta,
+                                        int seedID)
+{
+  unsigned int hadsum = 0;
+  unsigned int emsum = 0;
+  for (int i=0; i<3; ++i) { // phi
+    for (int j=0; j<=2; ++j) { // eta
+      if (((efex_id%3 == 0) && (fpga_id == 0) && (central_eta == 0) && (j == 0)) || ((efex_id%3 == 2) && (fpga_id == 3) && (central_eta == 5) && (j == 2))) {
+        continue;
+      } else {
+        const LVL1::eTower * tTower = towers.findTower(towerID[i][j]);
+        hadsum += tTower->getLayerTotalET(4);
+        if (j==1) {
+          emsum += ( tTower->getLayerTotalET(0) + tTower->getLayerTotalET(3) );
+        }
+      }
+    }
+  }
+  for (int i=seedID-1; i<=seedID+1; ++i) { // eta
+    for(int j=0; j<=2; ++j) { // phi
+      emsum += referenceWindowET(towers, towerID, efex_id, fpga_id, central_eta, 1, j, i);
+      emsum += referenceWindowET(towers, towerID, efex_id, fpga_id, central_eta, 2, j, i);
+    }
+  }
+  return std::vector<unsigned int> { emsum, hadsum };
+}
+
+
+// 3x3 towers with random cell ETs, towerID[phi][eta]
+void makeTowers(LVL1::eTowerContainer& towers, int towerID[3][3], std::mt19937& gen)
+{
+  std::uniform_real_distribution<float> et(0, 50000);
+  towers.clear();
+  for (int iphi = 0; iphi < 3; iphi++) {
+    for (int ieta = 0; ieta < 3; ieta++) {
+      towers.push_back(ieta, iphi, 100000, 1);
+      LVL1::eTower* tower = towers.back();
+      towerID[iphi][ieta] = tower->constid();
+      // cells 0: PS, 1-4: L1, 5-8: L2, 9: L3, 10-13: Had
+      const int layers[14] = {0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 4, 4, 4, 4};
+      for (int cell = 0; cell < 14; cell++) {
+        tower->setET(cell, et(gen), layers[cell]);
+      }
+    }
+  }
+  towers.fillContainerMap();
+}
+
+
+void compare(const LVL1::eTowerContainer& towers, const int towerID[3][3],
+             int efex_id, int fpga_id, int central_eta)
+{
+  LVL1::eFEXegAlgo::WindowCells cells;
+  LVL1::eFEXegAlgo::buildLayers(towers, towerID, efex_id, fpga_id, central_eta, cells);
+
+  for (int layer = 0; layer < 5; layer++) {
+    for (int jPhi = 0; jPhi < 3; jPhi++) {
+      for (int SCID = -4; SCID < 8; SCID++) {
+        assert (LVL1::eFEXegAlgo::windowET(cells, layer, jPhi, SCID) ==
+                referenceWindowET(towers, towerID, efex_id, fpga_id, central_eta, layer, jPhi, SCID));
+      }
+    }
+  }
+
+  std::vector<unsigned int> rhad;
+  for (int seedID = 0; seedID < 4; seedID++) {
+    LVL1::eFEXegAlgo::rhadSums(cells, seedID, rhad);
+    assert (rhad == referenceRhad(towers, towerID, efex_id, fpga_id, central_eta, seedID));
+  }
+}
+
+
+// Window inside the eFEX coverage
+void test1()
+{
+  std::cout << "test1\n";
+
+  std::mt19937 gen(12345);
+  LVL1::eTowerContainer towers;
+  int towerID[3][3];
+  for (int itest = 0; itest < 100; itest++) {
+    makeTowers(towers, towerID, gen);
+    compare(towers, towerID, 1, 2, 3);
+    compare(towers, towerID, 0, 0, 1);
+    compare(towers, towerID, 2, 3, 4);
+  }
+}
+
+
+// Windows at the eta edges of the eFEX coverage, where the outer towers are zero
+void test2()
+{
+  std::cout << "test2\n";
+
+  std::mt19937 gen(54321);
+  LVL1::eTowerContainer towers;
+  int towerID[3][3];
+  for (int itest = 0; itest < 100; itest++) {
+    makeTowers(towers, towerID, gen);
+    compare(towers, towerID, 0, 0, 0);
+    compare(towers, towerID, 3, 0, 0);
+    compare(towers, towerID, 2, 3, 5);
+    compare(towers, towerID, 5, 3, 5);
+  }
+
+  LVL1::eFEXegAlgo::WindowCells cells;
+  LVL1::eFEXegAlgo::buildLayers(towers, towerID, 0, 0, 0, cells);
+  for (int jPhi = 0; jPhi < 3; jPhi++) {
+    assert (LVL1::eFEXegAlgo::windowET(cells, 1, jPhi, -1) == 0);
+    assert (LVL1::eFEXegAlgo::windowET(cells, 4, jPhi, -1) == 0);
+  }
+  LVL1::eFEXegAlgo::buildLayers(towers, towerID, 2, 3, 5, cells);
+  for (int jPhi = 0; jPhi < 3; jPhi++) {
+    assert (LVL1::eFEXegAlgo::windowET(cells, 2, jPhi, 4) == 0);
+    assert (LVL1::eFEXegAlgo::windowET(cells, 0, jPhi, 4) == 0);
+  }
+}
+
+
+int main()
+{
+  std::cout << "eFEXegAlgo_test\n";
+  test1();
+  test2();
+  return 0;
+}
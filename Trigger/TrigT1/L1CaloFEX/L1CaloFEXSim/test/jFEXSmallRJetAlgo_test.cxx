@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+ */
+/**
+ * @file L1CaloFEXSim/test/jFEXSmallRJetAlgo_test.cxx
+ * @brief Unit tests for the jFEX small-R jet cluster sum.
+ */
+
+
+#undef NDEBUG
+#include "L1CaloFEXSim/jFEXSmallRJetAlgo.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+
+// The cluster sum as originally written, testing DeltaR^2 < 16 for every tower
+int referenceClusterET(const int towerET[7][7])
+{
+  int SRJetClusterET = 0;
+  for(int nphi = -3; nphi < 4; nphi++) {
+    for(int neta = -3; neta < 4; neta++) {
+      int DeltaRSquared = std::pow(nphi,2)+std::pow(neta,2);
+      if(DeltaRSquared < 16) {
+        SRJetClusterET += towerET[3+nphi][3+neta];
+      }
+    }
+  }
+  return SRJetClusterET;
+}
+
+
+// Number of towers in the cluster
+void test1()
+{
+  std::cout << "test1\n";
+
+  int towerET[7][7];
+  for (int iphi = 0; iphi < 7; iphi++) {
+    for (int ieta = 0; ieta < 7; ieta++) {
+      towerET[iphi][ieta] = 1;
+    }
+  }
+  assert (LVL1::jFEXSmallRJetAlgo::smallClusterET(towerET) == 45);
+  assert (referenceClusterET(towerET) == 45);
+}
+
+
+// Same sum as the reference on random tower grids
+void test2()
+{
+  std::cout << "test2\n";
+
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<int> et(0, 4095);
+  int towerET[7][7];
+  for (int itest = 0; itest < 10000; itest++) {
+    for (int iphi = 0; iphi < 7; iphi++) {
+      for (int ieta = 0; ieta < 7; ieta++) {
+        towerET[iphi][ieta] = et(gen);
+      }
+    }
+    assert (LVL1::jFEXSmallRJetAlgo::smallClusterET(towerET) == referenceClusterET(towerET));
+  }
+}
+
+
+int main()
+{
+  std::cout << "jFEXSmallRJetAlgo_test\n";
+  test1();
+  test2();
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /*********************************
  * Hyperbolic.h
@@ -22,6 +22,9 @@ namespace TSU {
    struct Hyperbolic{
      static const std::vector<std::string> Coshleg;
      static const std::vector<std::string> Cosh;
+     // the above as bit patterns, for the value c'tor of L1TopoDataTypes
+     static const std::vector<TSU::T> CoshlegBits;
+     static const std::vector<TSU::T> CoshBits;
    };
 }
 #endif
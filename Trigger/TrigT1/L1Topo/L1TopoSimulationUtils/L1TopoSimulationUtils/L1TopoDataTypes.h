@@ -11,6 +11,7 @@
 #ifndef L1TopoSimulationUtils_L1TOPODATATYPES_H
 #define L1TopoSimulationUtils_L1TOPODATATYPES_H
 #include <string>
+#include <vector>
 #include <iostream>
 #include <stdint.h>
 
@@ -218,6 +219,10 @@ namespace TSU {
     //T convert(const unsigned int& v, const unsigned& in_p, const unsigned int& in_f, 
     //                            const unsigned int& out_p, const unsigned int& out_f);
 
+    // bit patterns of a lookup table of binary strings, identical to what the string c'tor of L1TopoDataTypes reads;
+    // used to parse the LUTs once rather than at every evaluation of the TOB-pair kinematics
+    std::vector<T> to_bits(const std::vector<std::string>& lut);
+
     // represent T value with p bits as binary
     std::string to_binary(T value, const unsigned int& p);
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /*********************************
  * Trigo.h
@@ -23,6 +23,11 @@ namespace TSU {
      static const std::vector<std::string> Sinleg;
      static const std::vector<std::string> Cos;
      static const std::vector<std::string> Sin;
+     // the above as bit patterns, for the value c'tor of L1TopoDataTypes
+     static const std::vector<TSU::T> CoslegBits;
+     static const std::vector<TSU::T> SinlegBits;
+     static const std::vector<TSU::T> CosBits;
+     static const std::vector<TSU::T> SinBits;
      static int atan2leg(TSU::L1TopoDataTypes<16,0> x, TSU::L1TopoDataTypes<16,0> y);
      static int atan2(TSU::L1TopoDataTypes<16,0> x, TSU::L1TopoDataTypes<16,0> y);
    };
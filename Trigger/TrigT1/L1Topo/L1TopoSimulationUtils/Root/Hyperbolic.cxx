@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /*********************************
  * Hyperbolic.cxx
@@ -495,3 +495,7 @@ const std::vector<std::string> TSU::Hyperbolic::Cosh =
    "100010010110100011111011",	 // value = 8794.245117978593(8794.2451171875)		 argument value = 9.775
    "100011001110001101111101" // value = 9016.872491640062(9016.8720703125)		 argument value = 9.8	
   };
+
+// parsed once, after the string tables above in this translation unit
+const std::vector<TSU::T> TSU::Hyperbolic::CoshlegBits = TSU::to_bits(TSU::Hyperbolic::Coshleg);
+const std::vector<TSU::T> TSU::Hyperbolic::CoshBits = TSU::to_bits(TSU::Hyperbolic::Cosh);
@@ -33,7 +33,7 @@ unsigned int TSU::Kinematics::calcDeltaEtaBWLegacy(const TCS::GenericTOB* tob1,
 
 unsigned int TSU::Kinematics::calcInvMassBWLegacy(const TCS::GenericTOB* tob1, const TCS::GenericTOB* tob2){
 
-  auto bit_cosheta = TSU::L1TopoDataTypes<19,7>(TSU::Hyperbolic::Coshleg.at(std::abs(tob1->eta() - tob2->eta())));
+  auto bit_cosheta = TSU::L1TopoDataTypes<19,7>(TSU::Hyperbolic::CoshlegBits.at(std::abs(tob1->eta() - tob2->eta())));
   //In case of EM objects / jets / taus the phi angle goes between 0 and 64 while muons are between -32 and 32, applying a shift to keep delta-phi in the allowed range. 
   int phi_tob1 = tob1->phi();
   int phi_tob2 = tob2->phi();
@@ -43,7 +43,7 @@ unsigned int TSU::Kinematics::calcInvMassBWLegacy(const TCS::GenericTOB* tob1, c
       if(phi_tob1 >= 32) phi_tob1 = phi_tob1-64;
       if(phi_tob2 >= 32) phi_tob2 = phi_tob2-64;
     }
-  auto bit_cosphi = TSU::L1TopoDataTypes<9,7>(TSU::Trigo::Cosleg.at(std::abs( phi_tob1 - phi_tob2 )));
+  auto bit_cosphi = TSU::L1TopoDataTypes<9,7>(TSU::Trigo::CoslegBits.at(std::abs( phi_tob1 - phi_tob2 )));
   TSU::L1TopoDataTypes<11,0> bit_Et1(tob1->Et());
   TSU::L1TopoDataTypes<11,0> bit_Et2(tob2->Et());
   auto bit_invmass2 = bit_Et1*bit_Et2*(bit_cosheta - bit_cosphi)*2;
@@ -51,7 +51,7 @@ unsigned int TSU::Kinematics::calcInvMassBWLegacy(const TCS::GenericTOB* tob1, c
 }
 
 unsigned int TSU::Kinematics::calcTMassBWLegacy(const TCS::GenericTOB* tob1, const TCS::GenericTOB* tob2) {
-  auto bit_cosphi = TSU::L1TopoDataTypes<9,7>(TSU::Trigo::Cosleg.at(std::abs(tob1->phi() - tob2->phi())));
+  auto bit_cosphi = TSU::L1TopoDataTypes<9,7>(TSU::Trigo::CoslegBits.at(std::abs(tob1->phi() - tob2->phi())));
   TSU::L1TopoDataTypes<11,0> bit_Et1(tob1->Et());
   TSU::L1TopoDataTypes<11,0> bit_Et2(tob2->Et());
   TSU::L1TopoDataTypes<22,0> bit_tmass2 = 2*bit_Et1*bit_Et2*(1.  - bit_cosphi);
@@ -72,11 +72,11 @@ unsigned int TSU::Kinematics::calcDeltaR2BWLegacy(const TCS::GenericTOB* tob1, c
 }
 
 float TSU::Kinematics::calcCosLegacy(unsigned phi){
-  return static_cast<float>(TSU::L1TopoDataTypes<9,7>(TSU::Trigo::Cosleg.at(phi)));
+  return static_cast<float>(TSU::L1TopoDataTypes<9,7>(TSU::Trigo::CoslegBits.at(phi)));
 }
 
 float TSU::Kinematics::calcSinLegacy(unsigned phi){
-  return static_cast<float>(TSU::L1TopoDataTypes<9,7>(TSU::Trigo::Sinleg.at(phi)));
+  return static_cast<float>(TSU::L1TopoDataTypes<9,7>(TSU::Trigo::SinlegBits.at(phi)));
 }
 
 unsigned int TSU::Kinematics::calcDeltaPhiBW(const TCS::GenericTOB* tob1, const TCS::GenericTOB* tob2){
@@ -96,7 +96,7 @@ unsigned int TSU::Kinematics::calcDeltaEtaBW(const TCS::GenericTOB* tob1, const
 
 unsigned int TSU::Kinematics::calcInvMassBW(const TCS::GenericTOB* tob1, const TCS::GenericTOB* tob2){
 
-  auto bit_cosheta = TSU::L1TopoDataTypes<25,10>(TSU::Hyperbolic::Cosh.at(std::abs(tob1->eta() - tob2->eta())));
+  auto bit_cosheta = TSU::L1TopoDataTypes<25,10>(TSU::Hyperbolic::CoshBits.at(std::abs(tob1->eta() - tob2->eta())));
   //In case of EM objects / jets / taus the phi angle goes between 0 and 128 while muons are between -128 and 128, applying a shift to keep delta-phi in the allowed range. 
   //those cases should happen only in mixed EM/jets/tau plus mu triggers, if both phi's are in [0,2pi] will not get in
   int phi_tob1 = tob1->phi();
@@ -106,7 +106,7 @@ unsigned int TSU::Kinematics::calcInvMassBW(const TCS::GenericTOB* tob1, const T
       if(phi_tob1 >= 64) phi_tob1 = phi_tob1-128;
       if(phi_tob2 >= 64) phi_tob2 = phi_tob2-128;
     }
-  auto bit_cosphi = TSU::L1TopoDataTypes<12,10>(TSU::Trigo::Cos.at(std::abs( phi_tob1 - phi_tob2 )));
+  auto bit_cosphi = TSU::L1TopoDataTypes<12,10>(TSU::Trigo::CosBits.at(std::abs( phi_tob1 - phi_tob2 )));
   TSU::L1TopoDataTypes<15,0> bit_Et1(tob1->Et());
   TSU::L1TopoDataTypes<15,0> bit_Et2(tob2->Et());
   auto bit_invmass2 = bit_Et1*bit_Et2*(bit_cosheta - bit_cosphi)*2;
@@ -120,7 +120,7 @@ unsigned int TSU::Kinematics::calcInvMassBW(const TCS::GenericTOB* tob1, const T
 }
 
 unsigned int TSU::Kinematics::calcTMassBW(const TCS::GenericTOB* tob1, const TCS::GenericTOB* tob2) {
-  auto bit_cosphi = TSU::L1TopoDataTypes<12,10>(TSU::Trigo::Cos.at(std::abs(tob1->phi() - tob2->phi())));
+  auto bit_cosphi = TSU::L1TopoDataTypes<12,10>(TSU::Trigo::CosBits.at(std::abs(tob1->phi() - tob2->phi())));
   TSU::L1TopoDataTypes<11,0> bit_Et1(tob1->Et());
   TSU::L1TopoDataTypes<11,0> bit_Et2(tob2->Et());
   TSU::L1TopoDataTypes<22,0> bit_tmass2 = 2*bit_Et1*bit_Et2*(1.  - bit_cosphi);
@@ -198,11 +198,11 @@ unsigned int TSU::Kinematics::calcXi2(const TCS::GenericTOB* tob1, const TCS::Ge
 }
 
 float TSU::Kinematics::calcCos(unsigned phi){
-  return static_cast<float>(TSU::L1TopoDataTypes<12,10>(TSU::Trigo::Cos.at(phi)));
+  return static_cast<float>(TSU::L1TopoDataTypes<12,10>(TSU::Trigo::CosBits.at(phi)));
 }
 
 float TSU::Kinematics::calcSin(unsigned phi){
-  return static_cast<float>(TSU::L1TopoDataTypes<12,10>(TSU::Trigo::Sin.at(phi)));
+  return static_cast<float>(TSU::L1TopoDataTypes<12,10>(TSU::Trigo::SinBits.at(phi)));
 }
 
 /*------------------------------------------ NON-BITWISE --------------------------------------------------*/
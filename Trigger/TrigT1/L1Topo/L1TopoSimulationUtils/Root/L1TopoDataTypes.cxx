@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2018 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /*********************************
  * L1TopoDataTypes.cpp
@@ -24,6 +24,17 @@ TSU::T TSU::complement(const T& v, const unsigned int& p) {
    return res;
 }
 
+std::vector<TSU::T> TSU::to_bits(const std::vector<std::string>& lut) {
+   std::vector<T> res;
+   res.reserve(lut.size());
+   for(const std::string& b : lut) {
+      T v = 0;
+      for(char c : b) v = (v << 1) | (c == '1' ? 1ull : 0ull);
+      res.push_back(v);
+   }
+   return res;
+}
+
 TSU::T TSU::convert(const T& v, const unsigned& in_p, const unsigned int& in_f, const unsigned int& new_p, const unsigned int& new_f){
    T origval = v;
    // Check if sign bit is set and invert if so
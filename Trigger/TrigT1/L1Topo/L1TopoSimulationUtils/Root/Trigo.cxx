@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 /*********************************
  * Trigo.cxx
@@ -419,6 +419,12 @@ const std::vector<std::string> TSU::Trigo::Sin=
    "111111001110"          // -0.04906767432741809	
   };
 
+// parsed once, after the string tables above in this translation unit
+const std::vector<TSU::T> TSU::Trigo::CoslegBits = TSU::to_bits(TSU::Trigo::Cosleg);
+const std::vector<TSU::T> TSU::Trigo::SinlegBits = TSU::to_bits(TSU::Trigo::Sinleg);
+const std::vector<TSU::T> TSU::Trigo::CosBits = TSU::to_bits(TSU::Trigo::Cos);
+const std::vector<TSU::T> TSU::Trigo::SinBits = TSU::to_bits(TSU::Trigo::Sin);
+
 int TSU::Trigo::atan2leg(TSU::L1TopoDataTypes<16,0> x, TSU::L1TopoDataTypes<16,0> y){
   short int octant=0;
   if((x.value()&(1<<16))&&(y.value()&(1<<16))){ // Ex and Ey negative
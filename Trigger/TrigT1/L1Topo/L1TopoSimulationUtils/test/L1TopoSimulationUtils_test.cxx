@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -172,6 +172,32 @@ int test4()
 }
 
 
+// test5: the pre-parsed LUTs used by the kinematics must match the parsing of the binary strings
+int test5_compare(const char* name, const std::vector<std::string>& lut, const std::vector<TSU::T>& bits)
+{
+    if(lut.size() != bits.size()) return 1;
+    for(size_t i=0; i<lut.size(); ++i) {
+        if(TSU::L1TopoDataTypes<32,0>(lut[i]).value() != bits[i]) {
+            cout<<" "<<name<<" mismatch at "<<i<<" : "<<lut[i]<<" != "<<bits[i]<<endl;
+            return 1;
+        }
+    }
+    cout<<" "<<name<<" : "<<bits.size()<<" entries match"<<endl;
+    return 0;
+}
+int test5()
+{
+    cout << "** test5: L1TopoSimulationUtils LUT bit patterns**\n";
+    int result = 0;
+    result |= test5_compare("Coshleg", TSU::Hyperbolic::Coshleg, TSU::Hyperbolic::CoshlegBits);
+    result |= test5_compare("Cosh", TSU::Hyperbolic::Cosh, TSU::Hyperbolic::CoshBits);
+    result |= test5_compare("Cosleg", TSU::Trigo::Cosleg, TSU::Trigo::CoslegBits);
+    result |= test5_compare("Sinleg", TSU::Trigo::Sinleg, TSU::Trigo::SinlegBits);
+    result |= test5_compare("Cos", TSU::Trigo::Cos, TSU::Trigo::CosBits);
+    result |= test5_compare("Sin", TSU::Trigo::Sin, TSU::Trigo::SinBits);
+    return result;
+}
+
 
 int main()
 {  
@@ -179,5 +205,6 @@ int main()
   test2();
   test3();
   int result = test4();
+  result |= test5();
   return result;
 }
@@ -21,6 +21,9 @@ CLIDOffset = 1
 NameLengthOffset = 2
 NameOffset = 3
 
+# Copy of variables defined in TrigOutputHandling/src/TriggerEDMCompression.h
+CompressedFlag = 0x80000000
+
 
 class EDMCollection:
     '''A python representation of a serialised EDM collection'''
@@ -98,10 +101,44 @@ def get_collection_payload(raw_data_words):
     '''Extract the serialised collection payload from the full collection raw data'''
 
     name_size = raw_data_words[NameLengthOffset]
+    size_word = raw_data_words[NameOffset + name_size]
+    if size_word & CompressedFlag:
+        payload_start = NameOffset + name_size + 2
+        return decompress_payload(raw_data_words[payload_start:], size_word & ~CompressedFlag,
+                                  raw_data_words[NameOffset + name_size + 1])
     payload_start = NameOffset + name_size + 1
     return raw_data_words[payload_start:]
 
 
+def decompress_payload(words, compressed_size, size):
+    '''Decompress the ROOT compression blocks of a compressed collection payload into payload words'''
+
+    # Lazily import modules needed for decompression
+    import ROOT
+    import array
+    from ctypes import c_int
+
+    src = array.array('B', array.array('I', words).tobytes()[:compressed_size])
+    # Pad the output to full words
+    out = array.array('B', bytes(4 * ((size + 3) // 4)))
+    in_pos, out_pos = 0, 0
+    while in_pos < compressed_size:
+        block_size, block_out_size, n_read = c_int(0), c_int(0), c_int(0)
+        block = src[in_pos:]
+        if ROOT.R__unzip_header(block_size, block, block_out_size) != 0:
+            log.error('Corrupted compressed payload')
+            return []
+        block_out = array.array('B', bytes(block_out_size.value))
+        ROOT.R__unzip(block_size, block, block_out_size, block_out, n_read)
+        if n_read.value != block_out_size.value:
+            log.error('Failed to decompress payload')
+            return []
+        out[out_pos:out_pos+n_read.value] = block_out
+        in_pos += block_size.value
+        out_pos += n_read.value
+    return list(array.array('I', out.tobytes()))
+
+
 def get_collections(rob, skip_payload=False):
     '''
     Extract a list of EDMCollection objects from the HLT ROBFragment.
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef __TRIG_COMBINATORIAL_SETTINGS_H__
@@ -42,6 +42,19 @@ public:
     m_useTrigSeedML = 0;
     m_maxEC_len = 1.5;
     m_vLUT.clear();
+    m_layerPairs.clear();
+    m_layerPairsZv.clear();
+  }
+
+  // candidate layers for doublet making with a middle spacepoint on layer L, i.e. all layers which can pair with L
+  // given the layer geometry and the seed-type flags: returned[L] for createSeeds(roi) or, if zv is true,
+  // for createSeeds(roi, vZv)
+  std::vector<std::vector<int> > makeLayerPairs(bool zv) const;
+
+  // precomputes m_layerPairs and m_layerPairsZv, to be called once m_layerGeometry and the flags are set
+  void fillLayerPairTables() {
+    m_layerPairs = makeLayerPairs(false);
+    m_layerPairsZv = makeLayerPairs(true);
   }
 
   int m_maxBarrelPix, m_minEndcapPix, m_maxEndcapPix, m_maxSiliconLayer;
@@ -72,6 +85,9 @@ public:
   std::vector<TrigSeedML_LUT> m_vLUT;
   float m_maxEC_len;
 
+  std::vector<std::vector<int> > m_layerPairs;
+  std::vector<std::vector<int> > m_layerPairsZv;
+
 } TRIG_COMBINATORIAL_SETTINGS;
 
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TRIGINDETPATTRECOTOOLS_TRIGTRACKSEEDGENERATOR_H
@@ -385,7 +385,7 @@ private:
   std::vector<float> m_minTau;
   std::vector<float> m_maxTau;
 
-  bool validateLayerPairNew(int, int, float, float); 
+  bool validateLayerPairNew(int, float, float); 
   bool getSpacepointRange(int, const std::vector<const INDEXED_SP*>&, SP_RANGE&);
   int processSpacepointRange(int, const INDEXED_SP*, bool, const SP_RANGE&, const IRoiDescriptor*);
   int processSpacepointRangeZv(const INDEXED_SP*, bool, const SP_RANGE&, bool, const float&, const float&);
@@ -395,6 +395,12 @@ private:
   void storeTriplets(std::vector<TrigInDetTriplet>&);
 
   const TrigCombinatorialSettings& m_settings;
+
+  //candidate layers for doublet making, shared via the settings or made here if the settings have none
+  const std::vector<std::vector<int> >* m_layerPairs;
+  const std::vector<std::vector<int> >* m_layerPairsZv;
+  std::vector<std::vector<int> > m_ownLayerPairs, m_ownLayerPairsZv;
+
   double m_phiSliceWidth;
   double m_minDeltaRadius, m_maxDeltaRadius, m_maxDeltaRadiusConf, m_zTol;
 
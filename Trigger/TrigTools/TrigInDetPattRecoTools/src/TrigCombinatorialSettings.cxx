@@ -0,0 +1,49 @@
+/*
+  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TrigInDetPattRecoTools/TrigCombinatorialSettings.h"
+
+std::vector<std::vector<int> > TrigCombinatorialSettings::makeLayerPairs(bool zv) const {
+
+  int nLayers = (int)m_layerGeometry.size();
+
+  std::vector<std::vector<int> > layerPairs(nLayers);
+
+  for(int layerI=1;layerI<nLayers;layerI++) {//layer 0 is never used for middle spacepoints
+
+    bool isSct = (m_layerGeometry[layerI].m_subdet == 2);
+    int typeI = m_layerGeometry[layerI].m_type;
+    float refCoordI = m_layerGeometry[layerI].m_refCoord;
+
+    for(int layerJ=0;layerJ<nLayers;layerJ++) {
+
+      if(layerJ==layerI) continue;
+
+      bool isPixel2 = (m_layerGeometry[layerJ].m_subdet == 1);
+
+      if(zv) {
+	if((!m_tripletDoPSS) && (!m_tripletDoPPS)) {//no mixed seeds allowed
+	  if(isSct && isPixel2) continue;//no PSx
+	  if((!isSct) && (!isPixel2)) continue;//no xPS
+	}
+      }
+      else {
+	if(isSct && isPixel2 && (!m_tripletDoPSS)) continue;//no mixed PSS seeds allowed
+	if((!isSct) && (!isPixel2)) {// i.e. xPS (or SPx)
+	  if((!m_tripletDoConfirm) && (!m_tripletDoPPS)) continue;//no mixed PPS seeds allowed
+	  //but if m_tripletDoConfirm is true we will use PPS seeds to confirm PPP seeds
+	}
+      }
+
+      int typeJ = m_layerGeometry[layerJ].m_type;
+      float refCoordJ = m_layerGeometry[layerJ].m_refCoord;
+
+      if((typeI!=0) && (typeJ!=0) && refCoordI*refCoordJ<0.0) continue;//only ++ or -- EC combinations are allowed
+
+      layerPairs[layerI].push_back(layerJ);
+    }
+  }
+
+  return layerPairs;
+}
@@ -28,6 +28,22 @@ TrigTrackSeedGenerator::TrigTrackSeedGenerator(const TrigCombinatorialSettings&
   //m_nMaxRadBin = 1+(int)((m_maxRadius-m_minRadius)/m_radBinWidth);
   m_pStore = new L_PHI_STORAGE(m_settings.m_nMaxPhiSlice, (int)m_settings.m_layerGeometry.size());
 
+  //layer pair tables depend only on the geometry and the seed-type flags
+  if(m_settings.m_layerPairs.size() == m_settings.m_layerGeometry.size()) {
+    m_layerPairs = &m_settings.m_layerPairs;
+  }
+  else {
+    m_ownLayerPairs = m_settings.makeLayerPairs(false);
+    m_layerPairs = &m_ownLayerPairs;
+  }
+  if(m_settings.m_layerPairsZv.size() == m_settings.m_layerGeometry.size()) {
+    m_layerPairsZv = &m_settings.m_layerPairsZv;
+  }
+  else {
+    m_ownLayerPairsZv = m_settings.makeLayerPairs(true);
+    m_layerPairsZv = &m_ownLayerPairsZv;
+  }
+
   //mult scatt. variance for doublet matching
   const double radLen = 0.036;
   m_CovMS = std::pow((13.6/m_settings.m_tripletPtMin),2)*radLen;
@@ -169,6 +185,8 @@ void TrigTrackSeedGenerator::createSeeds(const IRoiDescriptor* roiDescriptor) {
     if(S.m_nSP==0) continue;
 
     bool isSct = (m_settings.m_layerGeometry[layerI].m_subdet == 2);
+
+    const std::vector<int>& layerPairs = (*m_layerPairs)[layerI];
     
     for(int phiI=0;phiI<m_settings.m_nMaxPhiSlice;phiI++) {
 
@@ -201,20 +219,11 @@ void TrigTrackSeedGenerator::createSeeds(const IRoiDescriptor* roiDescriptor) {
 	m_innerMarkers.clear();
 	m_outerMarkers.clear();
 
-	for(int layerJ=0;layerJ<nLayers;layerJ++) {
+	for(int layerJ : layerPairs) {//see TrigCombinatorialSettings::makeLayerPairs for the allowed seed types
 
 	  bool isPixel2 = (m_settings.m_layerGeometry[layerJ].m_subdet == 1);
 	  
-	  if(isSct && isPixel2 && (!m_settings.m_tripletDoPSS)) continue;//no mixed PSS seeds allowed
-
-	  if((!isSct) && (!isPixel2)) {// i.e. xPS (or SPx)
-	    if((!m_settings.m_tripletDoConfirm) && (!m_settings.m_tripletDoPPS)) {
-	      continue;//no mixed PPS seeds allowed
-	    }
-	    //but if m_tripletDoConfirm is true we will use PPS seeds to confirm PPP seeds
-	  }
-	  
-	  if(!validateLayerPairNew(layerI, layerJ, rm, zm)) continue; 
+	  if(!validateLayerPairNew(layerJ, rm, zm)) continue; 
 	    
 	  bool checkPSS = (!m_settings.m_tripletDoPSS) && (isSct && isPixel2);
 
@@ -293,6 +302,8 @@ void TrigTrackSeedGenerator::createSeeds(const IRoiDescriptor* roiDescriptor, co
     bool isBarrel = (m_settings.m_layerGeometry[layerI].m_type == 0);
     
     bool checkWidth = isBarrel && (!isSct) && (m_settings.m_useTrigSeedML > 0);
+
+    const std::vector<int>& layerPairs = (*m_layerPairsZv)[layerI];
     
     for(int phiI=0;phiI<m_settings.m_nMaxPhiSlice;phiI++) {
 
@@ -334,16 +345,11 @@ void TrigTrackSeedGenerator::createSeeds(const IRoiDescriptor* roiDescriptor, co
 	    m_zMinus = zVertex - m_settings.m_zvError;
 	    m_zPlus = zVertex + m_settings.m_zvError;
 
-	    for(int layerJ=0;layerJ<nLayers;layerJ++) {//loop over other layers
+	    for(int layerJ : layerPairs) {//loop over other layers, see TrigCombinatorialSettings::makeLayerPairs
 
 	      bool isPixel2 = (m_settings.m_layerGeometry[layerJ].m_subdet == 1);
 
-	      if((!m_settings.m_tripletDoPSS) && (!m_settings.m_tripletDoPPS)) {//no mixed seeds allowed
-		if(isSct && isPixel2) continue;//no PSx
-		if((!isSct) && (!isPixel2)) continue;//no xPS
-	      }
-
-	      if(!validateLayerPairNew(layerI, layerJ, rm, zm)) continue; 
+	      if(!validateLayerPairNew(layerJ, rm, zm)) continue; 
 	      
 	      bool checkPSS = (!m_settings.m_tripletDoPSS) && (isSct && isPixel2);
 
@@ -380,24 +386,18 @@ void TrigTrackSeedGenerator::createSeeds(const IRoiDescriptor* roiDescriptor, co
 
 }
 
-bool TrigTrackSeedGenerator::validateLayerPairNew(int layerI, int layerJ, float rm, float zm) {
+bool TrigTrackSeedGenerator::validateLayerPairNew(int layerJ, float rm, float zm) {
 
   const float deltaRefCoord = 5.0;
 
-  if(layerJ==layerI) return false;//skip the same layer ???
+  //same layer and +/- endcap pairs are excluded by the layer pair tables
 
   if(m_pStore->m_layers[layerJ].m_nSP==0) return false;
 
-  int typeI = m_settings.m_layerGeometry[layerI].m_type;
-
-  float refCoordI = m_settings.m_layerGeometry[layerI].m_refCoord;
-
   int typeJ = m_settings.m_layerGeometry[layerJ].m_type;
 
   float refCoordJ = m_settings.m_layerGeometry[layerJ].m_refCoord;
 
-  if((typeI!=0) && (typeJ!=0) && refCoordI*refCoordJ<0.0) return false;//only ++ or -- EC combinations are allowed
-
   //project beamline interval to the ref. coord of the layer
 
   bool isBarrel = (typeJ == 0);
@@ -221,6 +221,7 @@ int main()
   pVL.at(31).m_minBound = 438.426;
   pVL.at(31).m_maxBound = 562.272;
   tcs.m_layerGeometry = pVL;
+  tcs.fillLayerPairTables();
 
   std::vector<int> times;
   for (unsigned int i = 0; i < 10; ++i) {
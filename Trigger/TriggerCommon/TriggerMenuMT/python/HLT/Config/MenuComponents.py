@@ -15,7 +15,7 @@ from AthenaConfiguration.AthConfigFlags import AthConfigFlags
 from AthenaConfiguration.ComponentAccumulator import ComponentAccumulator
 from AthenaConfiguration.ComponentFactory import CompFactory
 from AthenaConfiguration.AccumulatorCache import AccumulatorCache
-from DecisionHandling.DecisionHandlingConfig import ComboHypoCfg
+from DecisionHandling.DecisionHandlingConfig import ComboHypoCfg, setupViewCreatorMonitoring, setupMergedSuperROIsFromPreExec
 from GaudiKernel.DataHandle import DataHandle
 from HLTSeeding.HLTSeedingConfig import mapThresholdToL1DecisionCollection
 from TrigCompositeUtils.TrigCompositeUtils import legName
@@ -205,6 +205,8 @@ class InputMakerNode(AlgNode):
         AlgNode.__init__(self,  Alg, 'InputMakerInputDecisions', 'InputMakerOutputDecisions')
         input_maker_output = CFNaming.inputMakerOutName(compName(self.Alg))
         self.addOutput(input_maker_output)
+        setupViewCreatorMonitoring(self.Alg)
+        setupMergedSuperROIsFromPreExec(self.Alg)
 
 
 class ComboMaker(AlgNode):